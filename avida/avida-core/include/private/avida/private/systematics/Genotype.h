@@ -63,6 +63,7 @@ namespace Avida {
       
       Source m_src;
       Genome m_genome;
+      unsigned long long m_fingerprint;   // of the genome's instruction sequence, set by the arbiter
       Apto::String m_name;
       
       bool m_threshold;
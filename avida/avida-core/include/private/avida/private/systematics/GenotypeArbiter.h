@@ -47,15 +47,17 @@ namespace Avida {
         EVENT_REMOVE_THRESHOLD
       };
       
-      static const int HASH_SIZE = 3203;
-      
     private:
+      static const int INITIAL_TABLE_SIZE = 4096;   // must be a power of two
+      
       // Config Settings
       int m_threshold;
       bool m_disable_class;
       
       // Internal Data Structures
-      Apto::List<GenotypePtr, Apto::SparseVector> m_active_hash[HASH_SIZE];
+      Apto::Array<GenotypePtr> m_active_table;          // active genotypes by genome fingerprint, open addressing
+      Apto::Array<unsigned long long> m_active_keys;    // fingerprint of the genotype in each slot of m_active_table
+      int m_active_count;
       Apto::Array<Apto::List<GenotypePtr, Apto::SparseVector>, Apto::ManagedPointer> m_active_sz;
       Apto::List<GenotypePtr, Apto::SparseVector> m_historic;
       GenotypePtr m_coalescent;
@@ -157,7 +159,11 @@ namespace Avida {
       template <class T> Data::PackagePtr packageData(const T&) const;
       Data::ProviderPtr activateProvider(World*);
       
-      unsigned int hashGenome(const InstructionSequence& genome) const;
+      unsigned long long fingerprintGenome(const Genome& genome) const;
+      GenotypePtr findActive(UnitPtr u, unsigned long long fingerprint);
+      void insertActive(GenotypePtr genotype);
+      void removeActive(GenotypePtr genotype);
+      void resizeActiveTable(int size);
       Apto::String nameGenotype(int size);
       
       void removeGenotype(GenotypePtr genotype);
@@ -41,7 +41,8 @@ const int RECEIVED_MESSAGES_SIZE = 10;
 enum eFileType
 {
   FILE_TYPE_TEXT,
-  FILE_TYPE_HTML
+  FILE_TYPE_HTML,
+  FILE_TYPE_CSV
 };
 
 enum eHARDWARE_TYPE
@@ -62,6 +63,9 @@ enum eTIMESLICE
   SLICE_DEME_PROB_MERIT,
   SLICE_PROB_DEMESIZE_PROB_MERIT,
   SLICE_PROB_INTEGRATED_MERIT,
+  SLICE_PROB_MERIT_BATCH,
+  SLICE_DEME_BLOCK,
+  SLICE_PROB_MERIT_ORDERED,
 };
 
 enum ePOSITION_OFFSPRING
@@ -74,11 +74,14 @@ namespace Avida {
   protected:
     Apto::Array<Instruction> m_seq;
     int m_active_size;
+    mutable unsigned long long m_fingerprint;   // cached result of Fingerprint()
+    mutable bool m_fingerprint_valid;           // cleared by anything that may change the sequence
 
   public:
-    LIB_EXPORT inline InstructionSequence() : m_active_size(0) { ; }
+    LIB_EXPORT inline InstructionSequence() : m_active_size(0), m_fingerprint(0), m_fingerprint_valid(false) { ; }
     LIB_EXPORT InstructionSequence(const InstructionSequence& seq);
-    LIB_EXPORT inline explicit InstructionSequence(int size) : m_seq(size), m_active_size(size) { ; }
+    LIB_EXPORT inline explicit InstructionSequence(int size)
+      : m_seq(size), m_active_size(size), m_fingerprint(0), m_fingerprint_valid(false) { ; }
     LIB_EXPORT explicit InstructionSequence(const Apto::String& str);
     LIB_EXPORT virtual ~InstructionSequence();
 
@@ -87,7 +90,13 @@ namespace Avida {
     LIB_EXPORT inline int GetSize() const { return m_active_size; }
     LIB_EXPORT inline int size() const { return m_active_size; }
 
-    LIB_EXPORT inline Instruction& operator[](int idx) { assert(idx >= 0 && idx < m_active_size);  return m_seq[idx]; }
+    // Writes through a reference from the non-const operator[] must not outlive the next call to Fingerprint()
+    LIB_EXPORT inline Instruction& operator[](int idx)
+    {
+      assert(idx >= 0 && idx < m_active_size);
+      m_fingerprint_valid = false;
+      return m_seq[idx];
+    }
     LIB_EXPORT inline const Instruction& operator[](int idx) const { assert(idx >= 0 && idx < m_active_size);  return m_seq[idx]; }
 
 
@@ -127,6 +136,17 @@ namespace Avida {
     LIB_EXPORT int MinDistBetween(const Instruction& inst) const;
     LIB_EXPORT inline bool HasInst(const Instruction& inst) const { return (FindInst(inst) >= 0); }
 
+    // 64-bit hash of the sequence; equal sequences always share a fingerprint, different ones almost never do.  It is
+    // computed once and kept (copies keep it too) until the sequence is modified.
+    LIB_EXPORT inline unsigned long long Fingerprint() const
+    {
+      if (!m_fingerprint_valid) {
+        m_fingerprint = computeFingerprint();
+        m_fingerprint_valid = true;
+      }
+      return m_fingerprint;
+    }
+
 
     // InstructionSequence Creation Methods
     LIB_EXPORT InstructionSequence Crop(int start, int end) const;
@@ -144,6 +164,7 @@ namespace Avida {
 
 
   protected:
+    LIB_EXPORT unsigned long long computeFingerprint() const;
     LIB_EXPORT virtual void adjustCapacity(int new_size);
     LIB_EXPORT virtual void prepareInsert(int pos, int num_sites);
   };
@@ -301,6 +301,7 @@ private:
 public:
   cActionSetGradientResource(cWorld* world, const cString& args, Feedback&) : cAction(world, args), env_string("")
   {
+    m_world->GetEnvironment().DeclareReactionValueWriter();
     cString largs(args);
     if (largs.GetSize()) env_string = largs;
     if (largs.GetSize()) largs.PopWord();
@@ -619,6 +620,7 @@ private:
 public:
   cActionChangeEnvironment(cWorld* world, const cString& args, Feedback&) : cAction(world, args), env_string("")
   {
+    m_world->GetEnvironment().DeclareReactionValueWriter();
     cString largs(args);
     if (largs.GetSize()) env_string = largs;
   }
@@ -657,6 +659,7 @@ private:
 public:
   cActionSetReactionValue(cWorld* world, const cString& args, Feedback&) : cAction(world, args), m_name(""), m_value(0.0)
   {
+    m_world->GetEnvironment().DeclareReactionValueWriter();
     cString largs(args);
     if (largs.GetSize()) m_name = largs.PopWord();
     if (largs.GetSize()) m_value = largs.PopWord().AsDouble();
@@ -680,6 +683,7 @@ private:
 public:
   cActionSetReactionValueMult(cWorld* world, const cString& args, Feedback&) : cAction(world, args), m_name(""), m_value(0.0)
   {
+    m_world->GetEnvironment().DeclareReactionValueWriter();
     cString largs(args);
     if (largs.GetSize()) m_name = largs.PopWord();
     if (largs.GetSize()) m_value = largs.PopWord().AsDouble();
@@ -1687,6 +1691,11 @@ public:
       m_world->GetDriver().Feedback().Error("Config variable specified in SetConfig action exist");
       m_world->GetDriver().Abort(Avida::INVALID_CONFIG);
     }
+    
+    // Reaction sensors read these settings alongside the reaction values themselves
+    if (m_cvar == "DISABLE_REACTION_SENSORS" || m_cvar == "REACTION_SENSORS_NEUTRAL") {
+      m_world->GetEnvironment().DeclareReactionValueWriter();
+    }
   }
   
   static const cString GetDescription() { return "Arguments: <string config_var> <string value>"; }
@@ -4035,14 +4035,12 @@ public:
       cerr << "cellB: " << temp_x << " " << temp_y << endl;
 #endif
       
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
-      cellA_list.Remove(&m_world->GetPopulation().GetCell(idB));
-      cellA_list.Remove(&m_world->GetPopulation().GetCell(idB0));
-      cellA_list.Remove(&m_world->GetPopulation().GetCell(idB1));
-      cellB_list.Remove(&m_world->GetPopulation().GetCell(idA));
-      cellB_list.Remove(&m_world->GetPopulation().GetCell(idA0));
-      cellB_list.Remove(&m_world->GetPopulation().GetCell(idA1));
+      cellA.RemoveConnection(m_world->GetPopulation().GetCell(idB));
+      cellA.RemoveConnection(m_world->GetPopulation().GetCell(idB0));
+      cellA.RemoveConnection(m_world->GetPopulation().GetCell(idB1));
+      cellB.RemoveConnection(m_world->GetPopulation().GetCell(idA));
+      cellB.RemoveConnection(m_world->GetPopulation().GetCell(idA0));
+      cellB.RemoveConnection(m_world->GetPopulation().GetCell(idA1));
     }
   }
 };
@@ -4112,14 +4110,12 @@ public:
       cerr << "cellB: " << temp_x << " " << temp_y << endl;
 #endif
       
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
-      cellA_list.Remove(&m_world->GetPopulation().GetCell(idB));
-      cellA_list.Remove(&m_world->GetPopulation().GetCell(idB0));
-      cellA_list.Remove(&m_world->GetPopulation().GetCell(idB1));
-      cellB_list.Remove(&m_world->GetPopulation().GetCell(idA));
-      cellB_list.Remove(&m_world->GetPopulation().GetCell(idA0));
-      cellB_list.Remove(&m_world->GetPopulation().GetCell(idA1));
+      cellA.RemoveConnection(m_world->GetPopulation().GetCell(idB));
+      cellA.RemoveConnection(m_world->GetPopulation().GetCell(idB0));
+      cellA.RemoveConnection(m_world->GetPopulation().GetCell(idB1));
+      cellB.RemoveConnection(m_world->GetPopulation().GetCell(idA));
+      cellB.RemoveConnection(m_world->GetPopulation().GetCell(idA0));
+      cellB.RemoveConnection(m_world->GetPopulation().GetCell(idA1));
     }
   }
 };
@@ -4173,28 +4169,24 @@ public:
       cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
       cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
       
-      //grab the cell lists
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
-      
       //these cells are always joined
-      if (cellA_list.FindPtr(&cellB)  == NULL) cellA_list.Push(&cellB);
-      if (cellB_list.FindPtr(&cellA)  == NULL) cellB_list.Push(&cellA);
+      if (!cellA.IsConnectedTo(cellB)) m_world->GetPopulation().ConnectCells(cellA, cellB, true);
+      if (!cellB.IsConnectedTo(cellA)) m_world->GetPopulation().ConnectCells(cellB, cellA, true);
       
       //make sure we don't break the bounded grid at the top
       if((nGeometry::GRID == geometry && row_id != 0) || nGeometry::GRID != geometry){
         cPopulationCell& cellA0 = m_world->GetPopulation().GetCell(GridNeighbor(idA, world_x, world_y,  0, -1));
         cPopulationCell& cellB0 = m_world->GetPopulation().GetCell(GridNeighbor(idA, world_x, world_y, -1, -1));
-        if (cellA_list.FindPtr(&cellB0) == NULL) cellA_list.Push(&cellB0);
-        if (cellB_list.FindPtr(&cellA0) == NULL) cellB_list.Push(&cellA0);
+        if (!cellA.IsConnectedTo(cellB0)) m_world->GetPopulation().ConnectCells(cellA, cellB0, true);
+        if (!cellB.IsConnectedTo(cellA0)) m_world->GetPopulation().ConnectCells(cellB, cellA0, true);
       }
       
       //make sure we don't break the bounded grid at the bottom
       if((nGeometry::GRID == geometry && row_id != (world_y-1)) || nGeometry::GRID != geometry){
         cPopulationCell& cellA1 = m_world->GetPopulation().GetCell(GridNeighbor(idA, world_x, world_y,  0,  1));
         cPopulationCell& cellB1 = m_world->GetPopulation().GetCell(GridNeighbor(idA, world_x, world_y, -1,  1));
-        if (cellA_list.FindPtr(&cellB1) == NULL) cellA_list.Push(&cellB1);
-        if (cellB_list.FindPtr(&cellA1) == NULL) cellB_list.Push(&cellA1);
+        if (!cellA.IsConnectedTo(cellB1)) m_world->GetPopulation().ConnectCells(cellA, cellB1, true);
+        if (!cellB.IsConnectedTo(cellA1)) m_world->GetPopulation().ConnectCells(cellB, cellA1, true);
       }
     }
   }
@@ -4249,28 +4241,24 @@ public:
       cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
       cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
       
-      //grab the cell lists
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
-      
       //these cells are always joined
-      if (cellA_list.FindPtr(&cellB)  == NULL) cellA_list.Push(&cellB);
-      if (cellB_list.FindPtr(&cellA)  == NULL) cellB_list.Push(&cellA);
+      if (!cellA.IsConnectedTo(cellB)) m_world->GetPopulation().ConnectCells(cellA, cellB, true);
+      if (!cellB.IsConnectedTo(cellA)) m_world->GetPopulation().ConnectCells(cellB, cellA, true);
       
       //make sure we don't break the bounded grid on the left
       if((nGeometry::GRID == geometry && col_id != 0) || nGeometry::GRID != geometry){
         cPopulationCell& cellA0 = m_world->GetPopulation().GetCell(GridNeighbor(idA, world_x, world_y, -1,  0));
         cPopulationCell& cellB0 = m_world->GetPopulation().GetCell(GridNeighbor(idA, world_x, world_y, -1, -1));
-        if (cellA_list.FindPtr(&cellB0) == NULL) cellA_list.Push(&cellB0);
-        if (cellB_list.FindPtr(&cellA0) == NULL) cellB_list.Push(&cellA0);
+        if (!cellA.IsConnectedTo(cellB0)) m_world->GetPopulation().ConnectCells(cellA, cellB0, true);
+        if (!cellB.IsConnectedTo(cellA0)) m_world->GetPopulation().ConnectCells(cellB, cellA0, true);
       }
       
       //make cure we don't break the bounded grid on the right
       if((nGeometry::GRID == geometry && col_id != (world_x-1)) || nGeometry::GRID != geometry){
         cPopulationCell& cellA1 = m_world->GetPopulation().GetCell(GridNeighbor(idA, world_x, world_y,  1,  0));
         cPopulationCell& cellB1 = m_world->GetPopulation().GetCell(GridNeighbor(idA, world_x, world_y,  1, -1));
-        if (cellA_list.FindPtr(&cellB1) == NULL) cellA_list.Push(&cellB1);
-        if (cellB_list.FindPtr(&cellA1) == NULL) cellB_list.Push(&cellA1);
+        if (!cellA.IsConnectedTo(cellB1)) m_world->GetPopulation().ConnectCells(cellA, cellB1, true);
+        if (!cellB.IsConnectedTo(cellA1)) m_world->GetPopulation().ConnectCells(cellB, cellA1, true);
       }
     }
   }
@@ -4309,10 +4297,8 @@ public:
     int idB = m_b_y * world_x + m_b_x;
     cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
     cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
-    tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-    tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
-    cellA_list.PushRear(&cellB);
-    cellB_list.PushRear(&cellA);
+    m_world->GetPopulation().ConnectCells(cellA, cellB, false);
+    m_world->GetPopulation().ConnectCells(cellB, cellA, false);
   }
 };
 
@@ -4349,10 +4335,8 @@ public:
     int idB = m_b_y * world_x + m_b_x;
     cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
     cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
-    tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-    tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
-    cellA_list.Remove(&cellB);
-    cellB_list.Remove(&cellA);
+    cellA.RemoveConnection(cellB);
+    cellB.RemoveConnection(cellA);
   }
 };
 
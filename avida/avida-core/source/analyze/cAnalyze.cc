@@ -31,6 +31,7 @@
 
 #include "avida/private/util/GenomeLoader.h"
 
+#include "apto/core/FileSystem.h"
 #include "apto/rng.h"
 #include "apto/scheduler.h"
 
@@ -55,6 +56,7 @@
 #include "cInstSet.h"
 #include "cLandscape.h"
 #include "cModularityAnalysis.h"
+#include "cOutputBuffer.h"
 #include "cPhenotype.h"
 #include "cPhenPlastGenotype.h"
 #include "cPlasticPhenotype.h"
@@ -99,6 +101,7 @@ cAnalyze::cAnalyze(cWorld* world)
  */
 , temporary_next_id(0)
 , temporary_next_update(0)
+, sequence_count(1)
 , batch(INITIAL_BATCHES)
 , variables(26)
 , local_variables(26)
@@ -107,6 +110,9 @@ cAnalyze::cAnalyze(cWorld* world)
 , m_world(world)
 , m_ctx(world->GetDefaultContext())
 , m_jobqueue(world)
+, m_working_dir(world->GetWorkingDir())
+, m_output_world(world->GetNewWorld())
+, m_own_output_world(false)
 , m_resources(NULL)
 , m_resource_time_spent_offset(0)
 , interactive_depth(0)
@@ -119,12 +125,47 @@ cAnalyze::cAnalyze(cWorld* world)
   
 }
 
+// Analyze object bound to a single run directory.  The world (configuration, instruction sets, environment) is shared
+// with any other analyze objects, while batches, variables, random state and the output manager belong to this run.
+cAnalyze::cAnalyze(cWorld* world, cAvidaContext& ctx, const cString& run_dir)
+: cur_batch(0)
+, temporary_next_id(0)
+, temporary_next_update(0)
+, sequence_count(1)
+, batch(INITIAL_BATCHES)
+, variables(26)
+, local_variables(26)
+, arg_variables(26)
+, exit_on_error(true)
+, m_world(world)
+, m_ctx(ctx)
+, m_jobqueue(world, ctx.GetRandom(), world->GetConfig().MAX_CONCURRENCY.Get())
+, m_working_dir(run_dir)
+, m_output_world(new World)
+, m_own_output_world(true)
+, m_resources(NULL)
+, m_resource_time_spent_offset(0)
+, interactive_depth(0)
+{
+  random.ResetSeed(m_world->GetConfig().RANDOM_SEED.Get());
+  
+  Apto::String opath = Apto::FileSystem::GetAbsolutePath(Apto::String(m_world->GetConfig().DATA_DIR.Get()),
+                                                         Apto::String(m_working_dir));
+  Output::ManagerPtr(new Output::Manager(opath))->AttachTo(m_output_world);
+  
+  for (int i = 0; i < GetNumBatches(); i++) {
+    batch[i].Name().Set("Batch%d", i);
+  }
+}
+
 
 
 cAnalyze::~cAnalyze()
 {
   while (command_list.GetSize()) delete command_list.Pop();
   while (function_list.GetSize()) delete function_list.Pop();
+  delete m_resources;
+  if (m_own_output_world) delete m_output_world;
 }
 
 
@@ -133,7 +174,7 @@ void cAnalyze::RunFile(cString filename)
   bool saved_analyze = m_ctx.GetAnalyzeMode();
   m_ctx.SetAnalyzeMode();
   
-  cInitFile analyze_file(filename, m_world->GetWorkingDir());
+  cInitFile analyze_file(filename, m_working_dir);
   if (!analyze_file.WasOpened()) {
     const cUserFeedback& feedback = analyze_file.GetFeedback();
     for (int i = 0; i < feedback.GetNumMessages(); i++) {
@@ -179,7 +220,7 @@ void cAnalyze::LoadOrganism(cString cur_string)
   // Setup the genome...
   GenomePtr genome;
   cUserFeedback feedback;
-  genome = Util::LoadGenomeDetailFile(filename, m_world->GetWorkingDir(), m_world->GetHardwareManager(), feedback);
+  genome = Util::LoadGenomeDetailFile(filename, m_working_dir, m_world->GetHardwareManager(), feedback);
   for (int i = 0; i < feedback.GetNumMessages(); i++) {
     switch (feedback.GetMessageType(i)) {
       case cUserFeedback::UF_ERROR:    cerr << "error: "; break;
@@ -212,7 +253,6 @@ void cAnalyze::LoadSequence(cString cur_string)
 {
   // LOAD_SEQUENCE
   
-  static int sequence_count = 1;
   cString sequence = cur_string.PopWord();
   cString seq_name = cur_string.PopWord();
   
@@ -257,7 +297,7 @@ void cAnalyze::LoadResources(cString cur_string)
   
   cout << "Loading Resources from: " << filename << endl;
   
-  if (!m_resources->LoadFile(filename, m_world->GetWorkingDir())) cerr << "error: failed to load resource file" << endl;
+  if (!m_resources->LoadFile(filename, m_working_dir)) cerr << "error: failed to load resource file" << endl;
 }
 
 double cAnalyze::AnalyzeEntropy(cAnalyzeGenotype* genotype, double mu) 
@@ -775,7 +815,7 @@ void cAnalyze::LoadFile(cString cur_string)
   
   cout << "Loading: " << filename << endl;
   
-  cInitFile input_file(filename, m_world->GetWorkingDir());
+  cInitFile input_file(filename, m_working_dir);
   if (!input_file.WasOpened()) {
     const cUserFeedback& feedback = input_file.GetFeedback();
     for (int i = 0; i < feedback.GetNumMessages(); i++) {
@@ -1659,7 +1699,7 @@ void cAnalyze::SampleOffspring(cString cur_string)
     Apto::Map<Apto::String, cAnalyzeGenotype*> genome_hash;
     
     for (int i=0; i<number_to_sample; i++) {
-      test_cpu->TestGenome(m_world->GetDefaultContext(), test_info, parent_genotype->GetGenome());
+      test_cpu->TestGenome(m_ctx, test_info, parent_genotype->GetGenome());
       cAnalyzeGenotype * offspring_genotype = NULL;
       InstructionSequencePtr offspring_seq_p;
       GeneticRepresentationPtr offspring_rep_p = test_info.GetTestOrganism(0)->OffspringGenome().Representation();
@@ -1788,7 +1828,7 @@ void cAnalyze::CommandTrace(cString cur_string)
       break;
     
     // Build the hardware status printer for tracing.
-    HardwareTracerPtr tracer(new cHardwareStatusPrinter(m_world->GetNewWorld(), (const char*)filename));
+    HardwareTracerPtr tracer(new cHardwareStatusPrinter(m_output_world, (const char*)filename));
     
     // Build the test info for printing.
     cCPUTestInfo test_info;  
@@ -1821,7 +1861,7 @@ void cAnalyze::CommandPrintTasks(cString cur_string)
   cString filename("tasks.dat");
   if (cur_string.GetSize() != 0) filename = cur_string.PopWord();
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   // Loop through all of the genotypes in this batch...
@@ -1843,7 +1883,7 @@ void cAnalyze::CommandPrintTasksQuality(cString cur_string)
   cString filename("tasksquality.dat");
   if (cur_string.GetSize() != 0) filename = cur_string.PopWord();
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   // Loop through all of the genotypes in this batch...
@@ -1878,13 +1918,14 @@ void cAnalyze::CommandDetail(cString cur_string)
   cString file_extension(filename);
   while (file_extension.Find('.') != -1) file_extension.Pop('.');
   if (file_extension == "html") file_type = FILE_TYPE_HTML;
+  else if (file_extension == "csv") file_type = FILE_TYPE_CSV;
   
   // Setup the file...
   if (filename == "cout") {
     CommandDetail_Header(cout, file_type, output_it);
     CommandDetail_Body(cout, file_type, output_it);
   } else {
-    Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename);
+    Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_output_world, (const char*)filename);
     ofstream& fp = df->OFStream();
     CommandDetail_Header(fp, file_type, output_it);
     CommandDetail_Body(fp, file_type, output_it);
@@ -1924,13 +1965,14 @@ void cAnalyze::CommandDetailTimeline(cString cur_string)
   cString file_extension(filename);
   while (file_extension.Find('.') != -1) file_extension.Pop('.');
   if (file_extension == "html") file_type = FILE_TYPE_HTML;
+  else if (file_extension == "csv") file_type = FILE_TYPE_CSV;
   
   // Setup the file...
   if (filename == "cout") {
     CommandDetail_Header(cout, file_type, output_it, time_step);
     CommandDetail_Body(cout, file_type, output_it, time_step, max_time);
   } else {
-    Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+    Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
     ofstream& fp = df->OFStream();
     CommandDetail_Header(fp, file_type, output_it, time_step);
     CommandDetail_Body(fp, file_type, output_it, time_step, max_time);
@@ -1948,7 +1990,17 @@ void cAnalyze::CommandDetail_Header(ostream& fp, int format_type,
   cAnalyzeGenotype* cur_genotype = batch[cur_batch].List().GetFirst();
 
   // Write out the header on the file
-  if (format_type == FILE_TYPE_TEXT) {
+  if (format_type == FILE_TYPE_CSV) {
+    // A single row of column names, as expected by spreadsheet and dataframe loaders
+    bool first = true;
+    if (time_step > 0) { fp << "update"; first = false; }
+    while (output_it.Next() != NULL) {
+      if (!first) fp << ",";
+      fp << output_it.Get()->GetName();
+      first = false;
+    }
+    fp << endl;
+  } else if (format_type == FILE_TYPE_TEXT) {
     fp << "#filetype genotype_data" << endl;
     fp << "#format ";
     if (time_step > 0) fp << "update ";
@@ -1996,6 +2048,19 @@ void cAnalyze::CommandDetail_Body(ostream& fp, int format_type,
                                   tListIterator< tDataEntryCommand<cAnalyzeGenotype> > & output_it,
                                   int time_step, int max_time)
 {
+  // Resolve the column list once, rather than walking the linked list for every genotype
+  Apto::Array<tDataEntryCommand<cAnalyzeGenotype>*> columns;
+  output_it.Reset();
+  while (output_it.Next() != NULL) columns.Push(output_it.Get());
+  const int num_columns = columns.GetSize();
+  
+  // Text and CSV rows are formatted into a large block and written out in bulk.  HTML stays on the stream, since it
+  // is only used for small, human-browsed batches.  When detailing to cout, each row is written as it completes, so
+  // that it stays in order with anything else printed while values are calculated.
+  cOutputBuffer* out = (format_type == FILE_TYPE_HTML) ? NULL : new cOutputBuffer(fp);
+  const bool flush_rows = (&fp == &cout);
+  const char separator = (format_type == FILE_TYPE_CSV) ? ',' : ' ';
+  
   // Loop through all of the genotypes in this batch...
   tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
   cAnalyzeGenotype * cur_genotype = batch_it.Next();
@@ -2009,19 +2074,13 @@ void cAnalyze::CommandDetail_Body(ostream& fp, int format_type,
       << " at depth " << cur_genotype->GetDepth()
       << endl;
     }
-    output_it.Reset();
     if (format_type == FILE_TYPE_HTML) {
       fp << "<tr>";
       if (time_step > 0) fp << "<td>" << cur_time << " ";
-    }
-    else if (time_step > 0) {  // TEXT file, printing times...
-      fp << cur_time << " ";
-    }
-    
-    tDataEntryCommand<cAnalyzeGenotype> * data_command = NULL;
-    while ((data_command = output_it.Next()) != NULL) {
-      cFlexVar cur_value = data_command->GetValue(cur_genotype);
-      if (format_type == FILE_TYPE_HTML) {
+      
+      for (int i = 0; i < num_columns; i++) {
+        tDataEntryCommand<cAnalyzeGenotype>* data_command = columns[i];
+        cFlexVar cur_value = data_command->GetValue(cur_genotype);
         int compare = 0;
         if (prev_genotype) {
           cFlexVar prev_value = data_command->GetValue(prev_genotype);
@@ -2030,12 +2089,27 @@ void cAnalyze::CommandDetail_Body(ostream& fp, int format_type,
         }
         HTMLPrintStat(cur_value, fp, compare, data_command->GetHtmlCellFlags(), data_command->GetNull());
       }
-      else {  // if (format_type == FILE_TYPE_TEXT) {
-        fp << data_command->GetValue(cur_genotype) << " ";
+      fp << "</tr>" << endl;
+    } else if (format_type == FILE_TYPE_CSV) {
+      if (time_step > 0) out->Append(cur_time);
+      for (int i = 0; i < num_columns; i++) {
+        if (i > 0 || time_step > 0) out->Append(separator);
+        out->AppendCSV(columns[i]->GetValue(cur_genotype));
+      }
+      out->EndLine();
+      if (flush_rows) out->Flush();
+    } else { // if (format_type == FILE_TYPE_TEXT) {
+      if (time_step > 0) {
+        out->Append(cur_time);
+        out->Append(separator);
       }
+      for (int i = 0; i < num_columns; i++) {
+        out->Append(columns[i]->GetValue(cur_genotype));
+        out->Append(separator);
       }
-    if (format_type == FILE_TYPE_HTML) fp << "</tr>";
-    fp << endl;
+      out->EndLine();
+      if (flush_rows) out->Flush();
+    }
     
     cur_time += time_step;
     if (time_step > 0) {
@@ -2053,6 +2127,7 @@ void cAnalyze::CommandDetail_Body(ostream& fp, int format_type,
     }
     
     }
+  delete out;
   
   // If in HTML mode, we need to end the file...
   if (format_type == FILE_TYPE_HTML) {
@@ -2110,11 +2185,11 @@ void cAnalyze::CommandDetailAverage(cString cur_string)
   cAnalyzeGenotype::GetDataCommandManager().LoadCommandList(cur_string, output_list);
   
   // check if file is already in use.
-  Avida::Output::ManagerPtr omgr = Avida::Output::Manager::Of(m_world->GetNewWorld());
+  Avida::Output::ManagerPtr omgr = Avida::Output::Manager::Of(m_output_world);
   Avida::Output::OutputID oid = omgr->OutputIDFromPath((const char*)filename);
   bool file_active = omgr->IsOpen(oid);
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), oid);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, oid);
   ofstream& fp = df->OFStream();
   
   // if it's a new file print out the header
@@ -2152,7 +2227,7 @@ void cAnalyze::CommandDetailBatches(cString cur_string)
   while (file_extension.Find('.') != -1) file_extension.Pop('.');
   if (file_extension == "html") file_type = FILE_TYPE_HTML;
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   cAnalyzeGenotype* first_genotype = batch[cur_batch].List().GetFirst();
   
@@ -2247,7 +2322,7 @@ void cAnalyze::CommandDetailIndex(cString cur_string)
   
   
   // Setup the file...
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   cAnalyzeGenotype* first_genotype = batch[cur_batch].List().GetFirst();
   
@@ -2356,7 +2431,7 @@ void cAnalyze::CommandHistogram(cString cur_string)
     CommandHistogram_Header(cout, file_type, output_it);
     CommandHistogram_Body(cout, file_type, output_it);
   } else {
-    Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+    Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
     ofstream& fp = df->OFStream();
     CommandHistogram_Header(fp, file_type, output_it);
     CommandHistogram_Body(fp, file_type, output_it);
@@ -2595,7 +2670,7 @@ void cAnalyze::CommandPrintPhenotypes(cString cur_string)
     phenotype_table.Set(phen_id, phenotype_stats);
   }
     
-  Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   fp << "# 1: Number of organisms of this phenotype" << endl
@@ -2734,7 +2809,7 @@ void cAnalyze::CommandPrintDiversity(cString cur_string)
   }
   
   // Print out the results...
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   
   for (int i = 0; i < num_tasks; i++) {
     df->Write(i,                    "# 1: Task ID");
@@ -2771,7 +2846,7 @@ void cAnalyze::PhyloCommunityComplexity(cString cur_string)
   }
   
   filename.Set("%s%s", static_cast<const char*>(directory), static_cast<const char*>(filename));
-  Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_output_world, (const char*)filename);
   ofstream& cpx_fp = df->OFStream();
   
   cpx_fp << "# Legend:" << endl;
@@ -3210,7 +3285,7 @@ void cAnalyze::CommandPrintDistances(cString cur_string)
     filename = "edit_distance.dat";
   }
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fout = df->OFStream();
   
   fout << "# All pairs edit distance" << endl;
@@ -3293,7 +3368,7 @@ void cAnalyze::CommandPrintTreeStats(cString cur_string)
   cString filename("tree_stats.dat");
   if (cur_string.GetSize() != 0) filename = cur_string.PopWord();
 
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
 
   fp << "# Legend:" << endl;
@@ -3319,7 +3394,7 @@ void cAnalyze::CommandPrintCumulativeStemminess(cString cur_string)
   cString filename("cumulative_stemminess.dat");
   if (cur_string.GetSize() != 0) filename = cur_string.PopWord();
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   fp << "# Legend:" << endl;
@@ -3371,7 +3446,7 @@ void cAnalyze::CommandPrintGamma(cString cur_string)
   // int furcation_time_convention = (cur_string.GetSize()) ? cur_string.PopWord().AsInt() : 1;
   int furcation_time_convention = 1;
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   fp << "# Legend:" << endl;
@@ -3385,7 +3460,7 @@ void cAnalyze::CommandPrintGamma(cString cur_string)
   fp << endl;
 
   if(lineage_thru_time_fname != ""){
-    Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)lineage_thru_time_fname);
+    Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)lineage_thru_time_fname);
     ofstream& ltt_fp = df->OFStream();
 
     ltt_fp << "# Legend:" << endl;
@@ -3428,7 +3503,7 @@ void cAnalyze::AnalyzeCommunityComplexity(cString cur_string)
   }
   
   filename.Set("%s%s", static_cast<const char*>(directory), static_cast<const char*>(filename));
-  Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_output_world, (const char*)filename);
   ofstream& cpx_fp = df->OFStream();
   
   cpx_fp << "# Legend:" << endl;
@@ -3764,7 +3839,7 @@ void cAnalyze::CommandPrintResourceFitnessMap(cString cur_string)
   // what file to write data to
   cString filename("resourcefitmap.dat");
   if (cur_string.GetSize() != 0) filename = cur_string.PopWord();
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
 
   int f1=-1, f2=-1, rangecount[2]={0,0}, threshcount[2]={0,0};
@@ -4081,8 +4156,8 @@ void cAnalyze::AnalyzeMateSelection(cString cur_string)
   // performing a random cross test.
   cAnalyzeGenotype * genotype2 = NULL;
   for (int test_id = 0; test_id < sample_size; test_id++) {
-    genotype = genotype_array[ m_world->GetRandom().GetUInt(org_count) ];
-    genotype2 = genotype_array[ m_world->GetRandom().GetUInt(org_count) ];
+    genotype = genotype_array[ m_ctx.GetRandom().GetUInt(org_count) ];
+    genotype2 = genotype_array[ m_ctx.GetRandom().GetUInt(org_count) ];
     
     // Stop immediately if we're comparing a genotype to itself.
     if (genotype == genotype2) {
@@ -4107,8 +4182,8 @@ void cAnalyze::AnalyzeMateSelection(cString cur_string)
     double end_frac = -1.0;
     double swap_frac = -1.0;
     while (swap_frac < min_swap_frac || swap_frac > max_swap_frac) {
-      start_frac = m_world->GetRandom().GetDouble();
-      end_frac = m_world->GetRandom().GetDouble();
+      start_frac = m_ctx.GetRandom().GetDouble();
+      end_frac = m_ctx.GetRandom().GetDouble();
       if (start_frac > end_frac) Swap(start_frac, end_frac);
       swap_frac = end_frac - start_frac;
     }
@@ -4177,7 +4252,7 @@ void cAnalyze::AnalyzeMateSelection(cString cur_string)
   
   if (filename == "none") return;
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   df->WriteComment( "Mate selection information" );
   df->WriteTimeStamp();  
   
@@ -4257,7 +4332,7 @@ void cAnalyze::AnalyzeComplexityDelta(cString cur_string)
   }
   
   // Open up the file and prepare it for output.
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   df->WriteComment( "An analyze of expected complexity changes between parent and offspring" );
   df->WriteTimeStamp();  
   
@@ -4265,7 +4340,7 @@ void cAnalyze::AnalyzeComplexityDelta(cString cur_string)
   // store the results.
   for (int cur_test = 0; cur_test < num_tests; cur_test++) {
     // Pick the genotype to test.
-    int test_org_id = m_world->GetRandom().GetInt(org_count);
+    int test_org_id = m_ctx.GetRandom().GetInt(org_count);
     genotype = org_array[test_org_id];
     
     // Create a copy of the genome.
@@ -4292,7 +4367,7 @@ void cAnalyze::AnalyzeComplexityDelta(cString cur_string)
     while (num_mutations == 0) {
       if (copy_mut_prob > 0.0) {
         for (int i = 0; i < mod_seq.GetSize(); i++) {
-          if (m_world->GetRandom().P(copy_mut_prob)) {
+          if (m_ctx.GetRandom().P(copy_mut_prob)) {
             mod_seq[i] = inst_set.GetRandomInst(m_ctx);
             num_mutations++;
           }
@@ -4300,15 +4375,15 @@ void cAnalyze::AnalyzeComplexityDelta(cString cur_string)
       }
       
       // Perform an Insertion if it has one.
-      if (m_world->GetRandom().P(ins_mut_prob)) {
-        ins_line = m_world->GetRandom().GetInt(mod_seq.GetSize() + 1);
+      if (m_ctx.GetRandom().P(ins_mut_prob)) {
+        ins_line = m_ctx.GetRandom().GetInt(mod_seq.GetSize() + 1);
         mod_seq.Insert(ins_line, inst_set.GetRandomInst(m_ctx));
         num_mutations++;
       }
       
       // Perform a Deletion if it has one.
-      if (m_world->GetRandom().P(del_mut_prob)) {
-        del_line = m_world->GetRandom().GetInt(mod_seq.GetSize());
+      if (m_ctx.GetRandom().P(del_mut_prob)) {
+        del_line = m_ctx.GetRandom().GetInt(mod_seq.GetSize());
         mod_seq.Remove(del_line);
         num_mutations++;
       }
@@ -4491,7 +4566,7 @@ void cAnalyze::AnalyzeKnockouts(cString cur_string)
   if (cur_string.GetSize() > 0) max_knockouts = cur_string.PopWord().AsInt();
   
   // Open up the data file...
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   df->WriteComment( "Analysis of knockouts in genomes" );
   df->WriteTimeStamp();  
   
@@ -5002,7 +5077,7 @@ genotype_vector cAnalyze::LoadDetailFileAsVector(cString cur_string)
   
   cout << "Loading: " << filename << endl;
   
-  cInitFile input_file(filename, m_world->GetWorkingDir());
+  cInitFile input_file(filename, m_working_dir);
   if (!input_file.WasOpened()) {
     const cUserFeedback& feedback = input_file.GetFeedback();
     for (int i = 0; i < feedback.GetNumMessages(); i++) {
@@ -6138,7 +6213,7 @@ void cAnalyze::CommandMapTasks(cString cur_string)
     } else {   //  if (file_type == FILE_TYPE_HTML) {
       filename.Set("%stasksites.%s.html", static_cast<const char*>(directory), static_cast<const char*>(genotype->GetName()));
     }
-    Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename);
+    Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_output_world, (const char*)filename);
     ofstream& fp = df->OFStream();
     
     // Construct linked filenames...
@@ -6406,7 +6481,7 @@ void cAnalyze::CommandAverageModularity(cString cur_string)
     cout << endl;
   }
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   // printing the headers
@@ -6732,7 +6807,7 @@ void cAnalyze::CommandAnalyzeModularity(cString cur_string)
   cString filename("analyze_modularity.dat");
   if (cur_string.GetSize() != 0) filename = cur_string.PopWord();
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   df->WriteComment( "Modularity Analysis" );
   df->WriteTimeStamp();
   
@@ -6909,7 +6984,7 @@ void cAnalyze::CommandAnalyzeRedundancyByInstFailure(cString cur_string)
   if (cur_string.GetSize() != 0) log10_step_size_pr_fail = cur_string.PopWord().AsDouble();
   
   // Output is one line per organism in the current batch with columns.
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   df->WriteComment( "Redundancy calculated by changing the probability of instruction failure" );
   cString s;
   s.Set("%i replicates at each chance of instruction failure", replicates);
@@ -7039,7 +7114,7 @@ void cAnalyze::CommandMapMutations(cString cur_string)
     if (m_world->GetVerbosity() >= VERBOSE_ON) {
       cout << "  Using filename \"" << filename << "\"" << endl;
     }
-    Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+    Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
     ofstream& fp = df->OFStream();
     
     // Calculate the stats for the genotype we're working with...
@@ -7285,7 +7360,7 @@ void cAnalyze::CommandMapDepth(cString cur_string)
   
   cout << "max_depth = " << max_depth << endl;
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   cout << "Output to " << filename << endl;
@@ -7372,7 +7447,7 @@ void cAnalyze::CommandHamming(cString cur_string)
   double ave_dist = (double) total_dist / (double) total_count;
   cout << " ave distance = " << ave_dist << endl;
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   
   df->WriteComment( "Hamming distance information" );
   df->WriteTimeStamp();  
@@ -7449,7 +7524,7 @@ void cAnalyze::CommandLevenstein(cString cur_string)
   double ave_dist = (double) total_dist / (double) total_count;
   cout << " ave distance = " << ave_dist << endl;
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   
   df->WriteComment( "Levenstein distance information" );
   df->WriteTimeStamp();  
@@ -7522,8 +7597,8 @@ void cAnalyze::CommandSpecies(cString cur_string)
           test_genome1_seq_p.DynamicCastFrom(test_genome1_rep_p);
           InstructionSequence& test_genome1_seq = *test_genome1_seq_p;
          
-          double start_frac = m_world->GetRandom().GetDouble();
-          double end_frac = m_world->GetRandom().GetDouble();
+          double start_frac = m_ctx.GetRandom().GetDouble();
+          double end_frac = m_ctx.GetRandom().GetDouble();
           if (start_frac > end_frac) Swap(start_frac, end_frac);
           
           int start0 = (int) (start_frac * (double) test_genome0_seq.GetSize());
@@ -7579,7 +7654,7 @@ void cAnalyze::CommandSpecies(cString cur_string)
   double ave_dist = (double) total_fail / (double) total_count;
   cout << "  ave distance = " << ave_dist  << " in " << total_count << " tests." << endl; 
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   
   df->WriteComment( "Species information" );
   df->WriteTimeStamp();  
@@ -7637,8 +7712,8 @@ void cAnalyze::CommandRecombine(cString cur_string)
         test_genome1_seq_p.DynamicCastFrom(test_genome1_rep_p);
         InstructionSequence& test_genome1_seq = *test_genome1_seq_p;
         
-        double start_frac = m_world->GetRandom().GetDouble();
-        double end_frac = m_world->GetRandom().GetDouble();
+        double start_frac = m_ctx.GetRandom().GetDouble();
+        double end_frac = m_ctx.GetRandom().GetDouble();
         if (start_frac > end_frac) Swap(start_frac, end_frac);
         
         int start0 = (int) (start_frac * (double) test_genome0_seq.GetSize());
@@ -7717,12 +7792,12 @@ void cAnalyze::CommandRecombineSample(cString cur_string)
 
   //Loop through X number of genotypes
   for (int i = 1; i <= num_compare; i++) {
-    genotype1 = batch[batch1].FindGenotypeRandom(m_world->GetRandom());
-    genotype2 = batch[batch2].FindGenotypeRandom(m_world->GetRandom());
+    genotype1 = batch[batch1].FindGenotypeRandom(m_ctx.GetRandom());
+    genotype2 = batch[batch2].FindGenotypeRandom(m_ctx.GetRandom());
     
     //50% chance of swapping genotype1 and genotype2 so that we don't always end up with 
     //    the same batch contributing the "ends" of the genome to the offspring
-    if (m_world->GetRandom().P(0.5)) {
+    if (m_ctx.GetRandom().P(0.5)) {
         cAnalyzeGenotype * temp = genotype1;
         genotype1 = genotype2;
         genotype2 = temp;
@@ -7737,8 +7812,8 @@ void cAnalyze::CommandRecombineSample(cString cur_string)
     seq0.DynamicCastFrom(test_genome0.Representation());
     seq1.DynamicCastFrom(test_genome1.Representation());
         
-    double start_frac = m_world->GetRandom().GetDouble();
-    double end_frac = m_world->GetRandom().GetDouble();
+    double start_frac = m_ctx.GetRandom().GetDouble();
+    double end_frac = m_ctx.GetRandom().GetDouble();
     if (start_frac > end_frac) Swap(start_frac, end_frac);
     
     int start0 = (int) (start_frac * (double) seq0->GetSize());
@@ -7934,7 +8009,7 @@ void cAnalyze::AnalyzeNewInfo(cString cur_string)
   
   cString newinfo_fn;
   newinfo_fn.Set("%s%s.newinfo.dat", static_cast<const char*>(directory), "lineage");
-  Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)newinfo_fn);
+  Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_output_world, (const char*)newinfo_fn);
   ofstream& newinfo_fp = df->OFStream();
   
   newinfo_fp << "# Legend:" << endl;
@@ -8006,7 +8081,7 @@ void cAnalyze::WriteClone(cString cur_string)
   if (cur_string.GetSize() != 0) num_cells = cur_string.PopWord().AsInt();
   
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   // Start up again at update zero...
@@ -8070,7 +8145,7 @@ void cAnalyze::WriteInjectEvents(cString cur_string)
   if (cur_string.GetSize() != 0) start_cell = cur_string.PopWord().AsInt();
   if (cur_string.GetSize() != 0) lineage = cur_string.PopWord().AsInt();
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   int org_count = 0;
@@ -8106,7 +8181,7 @@ void cAnalyze::WriteInjectInitial(cString cur_string)
   //if (cur_string.GetSize() != 0) start_cell = cur_string.PopWord().AsInt();
   if (cur_string.GetSize() != 0) lineage = cur_string.PopWord().AsInt();
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   int org_count = 0;
@@ -8164,7 +8239,7 @@ void cAnalyze::WriteCompetition(cString cur_string)
     return;
   }
   
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   // Count the number of organisms in each batch...
@@ -8295,7 +8370,7 @@ void cAnalyze::AnalyzeMuts(cString cur_string)
   cString & last_seq = sequences[num_sequences - 1];
   
   // Print out the header...
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   fp << "# " << sequences[0] << endl;
   fp << "# " << sequences[num_sequences - 1] << endl;
@@ -8464,7 +8539,7 @@ void cAnalyze::AnalyzeInstructions(cString cur_string)
   const int num_insts = inst_set.GetSize();
   
   // Setup the file...
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   // Determine the file type...
@@ -8615,7 +8690,7 @@ void cAnalyze::AnalyzeInstPop(cString cur_string)
   const int num_insts = inst_set.GetSize();
   
   // Setup the file...
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   for (int i = 0; i < num_insts; i++) {
@@ -8708,7 +8783,7 @@ void cAnalyze::AnalyzeMutationTraceback(cString cur_string)
   prev_inst.SetAll(-1);  // -1 indicates never changed.
   
   // Open the output file...
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(m_ctx);
@@ -8838,7 +8913,7 @@ void cAnalyze::AnalyzeComplexity(cString cur_string)
   } else {
     lineage_filename.Set("%s%s.complexity.dat", static_cast<const char*>(directory), "nonlineage");
   }
-  Avida::Output::FilePtr lineage_df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)lineage_filename);
+  Avida::Output::FilePtr lineage_df = Avida::Output::File::CreateWithPath(m_output_world, (const char*)lineage_filename);
   ofstream& lineage_fp = lineage_df->OFStream();
   
   while ((genotype = batch_it.Next()) != NULL) {
@@ -8849,7 +8924,7 @@ void cAnalyze::AnalyzeComplexity(cString cur_string)
     // Construct this filename...
     cString filename;
     filename.Set("%s%s.complexity.dat", static_cast<const char*>(directory), static_cast<const char*>(genotype->GetName()));
-    Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename);
+    Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_output_world, (const char*)filename);
     ofstream& fp = df->OFStream();
     
     lineage_fp << genotype->GetID() << " ";
@@ -9071,7 +9146,7 @@ void cAnalyze::AnalyzeFitnessLandscapeTwoSites(cString cur_string)
         // Construct filename for this site combination
         cString fl_filename;
         fl_filename.Set("%s%s_FitLand_sites-%d_and_%d.dat", static_cast<const char*>(directory), static_cast<const char*>(genotype->GetName()), site1, site2);
-        Avida::Output::FilePtr fit_land_fp = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)fl_filename);
+        Avida::Output::FilePtr fit_land_fp = Avida::Output::File::CreateWithPath(m_output_world, (const char*)fl_filename);
         fit_land_fp->WriteComment( "Two-site fitness landscape, all possible instructions" );
         fit_land_fp->WriteComment( cStringUtil::Stringf("Site 1: %d Site 2: %d", site1, site2) );
         fit_land_fp->WriteComment( "Rows #- instruction, site 1" );
@@ -9170,7 +9245,7 @@ void cAnalyze::AnalyzeLineageComplexitySitesN(cString cur_string)
     // Construct filename
     cString filename_2s;
     filename_2s.Set("complexity.dat");
-    Avida::Output::FilePtr fp_2s = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename_2s);
+    Avida::Output::FilePtr fp_2s = Avida::Output::File::CreateWithPath(m_output_world, (const char*)filename_2s);
     fp_2s->WriteComment( "Lineage Complexity Analysis" );
     fp_2s->WriteTimeStamp();
 
@@ -9425,7 +9500,7 @@ void cAnalyze::AnalyzeComplexityTwoSites(cString cur_string)
   // create file for batch summary
   cString summary_filename;
   summary_filename.Set("%scomplexity_batch_summary.dat", static_cast<const char*>(directory));
-  Avida::Output::FilePtr summary_fp = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)summary_filename);
+  Avida::Output::FilePtr summary_fp = Avida::Output::File::CreateWithPath(m_output_world, (const char*)summary_filename);
   summary_fp->WriteComment( "One, Two Site Entropy/Complexity Analysis" );
   summary_fp->WriteTimeStamp();
   
@@ -9450,7 +9525,7 @@ void cAnalyze::AnalyzeComplexityTwoSites(cString cur_string)
     // Construct filename
     cString filename_2s;
     filename_2s.Set("%s%s.twosite.complexity.dat", static_cast<const char*>(directory), static_cast<const char*>(genotype->GetName()));
-    Avida::Output::FilePtr fp_2s = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename_2s);
+    Avida::Output::FilePtr fp_2s = Avida::Output::File::CreateWithPath(m_output_world, (const char*)filename_2s);
     fp_2s->WriteComment( "One, Two Site Entropy/Complexity Analysis" );
     fp_2s->WriteComment( "NOTE: mutual information = (col 6 + col 8) - (col 9)" );
     fp_2s->WriteComment( "NOTE: possible negative mutual information-- is this real? " );
@@ -9871,7 +9946,7 @@ void cAnalyze::AnalyzePopComplexity(cString cur_string)
   // Construct filename...
   cString filename;
   filename.Set("%spop%s.complexity.dat", static_cast<const char*>(directory), static_cast<const char*>(file));
-  Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_output_world, (const char*)filename);
   ofstream& fp = df->OFStream();
   
   //////////////////////////////////////////////////////////
@@ -9959,7 +10034,7 @@ void cAnalyze::MutationRevert(cString cur_string)
   
 	
 	//Request a file
-  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_output_world, (const char*)filename);
   ofstream& FOT = df->OFStream();
 	/*
    FOT output per line
@@ -10232,6 +10307,40 @@ void cAnalyze::BatchPurge(cString cur_string)
   batch[batch_id].SetAligned(false);
 }
 
+void cAnalyze::BatchCompact(cString cur_string)
+{
+  int batch_id = cur_batch;
+  if (cur_string.CountNumWords() > 0) batch_id = cur_string.PopWord().AsInt();
+  
+  if (m_world->GetVerbosity() >= VERBOSE_ON) cout << "Compacting batch " << batch_id << endl;
+  
+  const int num_genotypes = batch[batch_id].List().GetSize();
+  if (num_genotypes == 0) return;
+  
+  // String data shared between genotypes is only counted once, both before and after the pass
+  std::set<const char*> strings_before;
+  std::set<const char*> strings_after;
+  double bytes_before = 0.0;
+  double bytes_after = 0.0;
+  
+  // The pool only lives for this pass; afterwards the genotypes hold the shared strings themselves
+  Apto::Map<cString, cString> pool;
+  int replaced = 0;
+  tListIterator<cAnalyzeGenotype> batch_it(batch[batch_id].List());
+  cAnalyzeGenotype* genotype = NULL;
+  while ((genotype = batch_it.Next()) != NULL) bytes_before += genotype->GetMemoryUsage(strings_before);
+  batch_it.Reset();
+  while ((genotype = batch_it.Next()) != NULL) {
+    replaced += genotype->Compact(pool);
+    bytes_after += genotype->GetMemoryUsage(strings_after);
+  }
+  
+  cout << "  Batch " << batch_id << " -- " << num_genotypes << " genotypes, bytes per genotype: "
+       << (bytes_before / num_genotypes) << " before, " << (bytes_after / num_genotypes) << " after ("
+       << replaced << " separately stored strings replaced by shared copies of " << pool.GetSize() << " distinct values)"
+       << endl;
+}
+
 void cAnalyze::BatchDuplicate(cString cur_string)
 {
   if (cur_string.GetSize() == 0) {
@@ -10434,7 +10543,7 @@ void cAnalyze::BatchRename(cString cur_string)
 
 void cAnalyze::CloseFile(cString cur_string)
 {
-  Avida::Output::ManagerPtr omgr = Avida::Output::Manager::Of(m_world->GetNewWorld());
+  Avida::Output::ManagerPtr omgr = Avida::Output::Manager::Of(m_output_world);
   omgr->Close(omgr->OutputIDFromPath((const char*)cur_string.PopWord()));
 }
 
@@ -10502,7 +10611,7 @@ void cAnalyze::IncludeFile(cString cur_string)
   while (cur_string.GetSize() > 0) {
     cString filename = cur_string.PopWord();
     
-    cInitFile include_file(filename, m_world->GetWorkingDir());
+    cInitFile include_file(filename, m_working_dir);
     
     tList<cAnalyzeCommand> include_list;
     LoadCommandList(include_file, include_list);
@@ -10586,7 +10695,7 @@ void cAnalyze::BatchCompete(cString cur_string)
   const int parent_batch_size = batch[batch_from].List().GetSize();
   
   /* Create scheduler. */
-  Apto::SmartPtr<Apto::Random> rng(new Apto::RNG::AvidaRNG(m_world->GetRandom().GetInt(m_world->GetRandom().MaxSeed())));
+  Apto::SmartPtr<Apto::Random> rng(new Apto::RNG::AvidaRNG(m_ctx.GetRandom().GetInt(m_ctx.GetRandom().MaxSeed())));
   Apto::PriorityScheduler* schedule = new Apto::Scheduler::Probabilistic(parent_batch_size, rng);
   
   /* Initialize scheduler with fitness values per-organism. */
@@ -10606,7 +10715,7 @@ void cAnalyze::BatchCompete(cString cur_string)
   int array_pos = 0;
   while ((genotype = batch_it.Next()) != NULL) {
     genotype_array[array_pos] = genotype;
-    genotype->Recalculate(m_world->GetDefaultContext(), &test_info, NULL);
+    genotype->Recalculate(m_ctx, &test_info, NULL);
     if(genotype->GetViable()){
       /*
        FIXME@kgn
@@ -10654,21 +10763,21 @@ void cAnalyze::BatchCompete(cString cur_string)
     
     if (copy_mut_prob > 0.0) {
       for (int n = 0; n < child_seq.GetSize(); n++) {
-        if (m_world->GetRandom().P(copy_mut_prob)) {
+        if (m_ctx.GetRandom().P(copy_mut_prob)) {
           child_seq[n] = inst_set.GetRandomInst(m_ctx);
         }
       }
     }
     
     /* Perform an Insertion if it has one. */
-    if (m_world->GetRandom().P(ins_mut_prob)) {
-      ins_line = m_world->GetRandom().GetInt(child_seq.GetSize() + 1);
+    if (m_ctx.GetRandom().P(ins_mut_prob)) {
+      ins_line = m_ctx.GetRandom().GetInt(child_seq.GetSize() + 1);
       child_seq.Insert(ins_line, inst_set.GetRandomInst(m_ctx));
     }
     
     /* Perform a Deletion if it has one. */
-    if (m_world->GetRandom().P(del_mut_prob)) {
-      del_line = m_world->GetRandom().GetInt(child_seq.GetSize());
+    if (m_ctx.GetRandom().P(del_mut_prob)) {
+      del_line = m_ctx.GetRandom().GetInt(child_seq.GetSize());
       child_seq.Remove(del_line);
     }
     
@@ -11308,6 +11417,7 @@ void cAnalyze::SetupCommandDefLibrary()
   AddLibraryDef("NAME_BATCH", &cAnalyze::BatchName);
   AddLibraryDef("TAG_BATCH", &cAnalyze::BatchTag);
   AddLibraryDef("PURGE_BATCH", &cAnalyze::BatchPurge);
+  AddLibraryDef("COMPACT_BATCH", &cAnalyze::BatchCompact);
   AddLibraryDef("DUPLICATE", &cAnalyze::BatchDuplicate);
   AddLibraryDef("RECALCULATE", &cAnalyze::BatchRecalculate);
   AddLibraryDef("RECALC", &cAnalyze::BatchRecalculateWithArgs);
@@ -76,6 +76,7 @@ private:
   */
   int temporary_next_id;
   int temporary_next_update;
+  int sequence_count;   // Numbers the genotypes LOAD_SEQUENCE has to name itself
   void SetTempNextUpdate(int next){ temporary_next_update = next; }
   void SetTempNextID(int next){ temporary_next_id = next; }
   int GetTempNextUpdate(){ return temporary_next_update; }
@@ -95,6 +96,13 @@ private:
   cAvidaContext& m_ctx;
   cAnalyzeJobQueue m_jobqueue;
 
+  // Input files are resolved against m_working_dir and output files are written through the output manager attached
+  // to m_output_world.  Both default to those of m_world, but are replaced with per-run values when the analyze
+  // object has been created to process a single run directory of a multi-run batch (see cAnalyzeMultiRun).
+  cString m_working_dir;
+  Avida::World* m_output_world;
+  bool m_own_output_world;
+
   // This is the storage for the resource information from resource.dat.
   cResourceHistory* m_resources;
   int m_resource_time_spent_offset; // The amount to offset the time spent when 
@@ -132,6 +140,7 @@ private:
 
 public:
   cAnalyze(cWorld* world);
+  cAnalyze(cWorld* world, cAvidaContext& ctx, const cString& run_dir);
   ~cAnalyze();
 
   void RunFile(cString filename);
@@ -322,6 +331,7 @@ private:
   void BatchName(cString cur_string);
   void BatchTag(cString cur_string);
   void BatchPurge(cString cur_string);
+  void BatchCompact(cString cur_string);
   void BatchDuplicate(cString cur_string);
   void BatchRecalculate(cString cur_string);
   void BatchRecalculateWithArgs(cString cur_string);
@@ -50,13 +50,15 @@ using namespace Avida;
 cAnalyzeGenotype::cAnalyzeGenotype(cWorld* world, const Genome& genome)
 : m_world(world)
 , m_genome(genome)
-, name("")
-, m_cpu_test_info()
+, name(emptyString())
+, m_cpu_test_info(NULL)
 , m_data(new sGenotypeDatastore)
-, aligned_sequence("")
-, tag("")
+, aligned_sequence(emptyString())
+, tag(emptyString())
 , viable(false)
 , id_num(-1)
+, m_src_args(emptyString())
+, m_parent_str(emptyString())
 , parent_id(-1)
 , parent2_id(-1)
 , num_cpus(0)
@@ -64,6 +66,8 @@ cAnalyzeGenotype::cAnalyzeGenotype(cWorld* world, const Genome& genome)
 , update_born(0)
 , update_dead(0)
 , depth(0)
+, m_cells(emptyString())
+, m_gest_offsets(emptyString())
 , length(0)
 , copy_length(0)
 , exe_length(0)
@@ -71,10 +75,9 @@ cAnalyzeGenotype::cAnalyzeGenotype(cWorld* world, const Genome& genome)
 , gest_time(INT_MAX)
 , fitness(0.0)
 , errors(0)
+, executed_flags(emptyString())
 , inst_executed_counts(0)
-, task_counts(0)
 , task_qualities(0)
-, internal_task_counts(0)
 , internal_task_qualities(0)
 , rbins_total(0)
 , rbins_avail(0)
@@ -88,9 +91,10 @@ cAnalyzeGenotype::cAnalyzeGenotype(cWorld* world, const Genome& genome)
 , comp_merit_ratio(0.0)
 , parent_dist(0)
 , ancestor_dist(0)
-, parent_muts("")
+, parent_muts(emptyString())
 , knockout_stats(NULL)
 , m_land(NULL)
+, task_order(emptyString())
 , m_phenplast_stats(NULL)
 {
 
@@ -100,7 +104,7 @@ cAnalyzeGenotype::cAnalyzeGenotype(const cAnalyzeGenotype& _gen)
 : m_world(_gen.m_world)
 , m_genome(_gen.m_genome)
 , name(_gen.name)
-, m_cpu_test_info(_gen.m_cpu_test_info)
+, m_cpu_test_info(NULL)
 , m_data(_gen.m_data)
 , aligned_sequence(_gen.aligned_sequence)
 , tag(_gen.tag)
@@ -142,6 +146,7 @@ cAnalyzeGenotype::cAnalyzeGenotype(const cAnalyzeGenotype& _gen)
 , m_land(NULL)
 , m_phenplast_stats(NULL)
 {
+  if (_gen.m_cpu_test_info != NULL) m_cpu_test_info = new cCPUTestInfo(*_gen.m_cpu_test_info);
   if (_gen.knockout_stats != NULL) {
     knockout_stats = new cAnalyzeKnockouts;
     *knockout_stats = *(_gen.knockout_stats);
@@ -152,12 +157,93 @@ cAnalyzeGenotype::cAnalyzeGenotype(const cAnalyzeGenotype& _gen)
 
 cAnalyzeGenotype::~cAnalyzeGenotype()
 {
+  delete m_cpu_test_info;
   if (knockout_stats != NULL) delete knockout_stats;
+  delete m_land;
   if (m_phenplast_stats != NULL) delete m_phenplast_stats;
   Unlink();
 }
 
 
+const cString& cAnalyzeGenotype::emptyString()
+{
+  static const cString s_empty("");
+  return s_empty;
+}
+
+int cAnalyzeGenotype::internString(cString& str, Apto::Map<cString, cString>& pool)
+{
+  // Equal strings are merged only when stored separately; copies of one string already share their data
+  cString pooled;
+  if (str.GetSize() == 0) pooled = emptyString();
+  else if (!pool.Get(str, pooled)) {
+    pool.Set(str, str);
+    return 0;
+  }
+  if (pooled.GetData() == str.GetData()) return 0;
+  
+  str = pooled;
+  return 1;
+}
+
+
+void cAnalyzeGenotype::SetCPUTestInfo(cCPUTestInfo& in_cpu_test_info)
+{
+  if (m_cpu_test_info == NULL) m_cpu_test_info = new cCPUTestInfo(in_cpu_test_info);
+  else *m_cpu_test_info = in_cpu_test_info;
+}
+
+int cAnalyzeGenotype::Compact(Apto::Map<cString, cString>& pool)
+{
+  // Fields that typically repeat across a batch are pooled.  Unique strings (name, sequence derived strings) are only
+  // shared when empty, to keep the pool from growing with the batch.
+  int replaced = internString(tag, pool) + internString(m_src_args, pool) + internString(task_order, pool);
+  
+  cString* unique_strs[] = { &name, &aligned_sequence, &m_parent_str, &m_cells, &m_gest_offsets, &executed_flags,
+                             &parent_muts };
+  for (unsigned int i = 0; i < sizeof(unique_strs) / sizeof(cString*); i++) {
+    if (unique_strs[i]->GetSize() == 0) replaced += internString(*unique_strs[i], pool);
+  }
+  
+  return replaced;
+}
+
+int cAnalyzeGenotype::GetMemoryUsage(std::set<const char*>& counted_strings) const
+{
+  // Estimated heap footprint of a reference counted string: data block (refcount, size, pointer) plus characters
+  const int string_overhead = sizeof(int) * 2 + sizeof(char*);
+  
+  int bytes = sizeof(cAnalyzeGenotype);
+  
+  ConstInstructionSequencePtr seq;
+  seq.DynamicCastFrom(m_genome.Representation());
+  if (seq) bytes += sizeof(InstructionSequence) + seq->GetSize() * sizeof(Instruction);
+  
+  const cString* strs[] = { &name, &aligned_sequence, &tag, &m_src_args, &m_parent_str, &m_cells, &m_gest_offsets,
+                            &executed_flags, &parent_muts, &task_order };
+  for (unsigned int i = 0; i < sizeof(strs) / sizeof(cString*); i++) {
+    if (counted_strings.insert(strs[i]->GetData()).second) bytes += string_overhead + strs[i]->GetSize() + 1;
+  }
+  
+  bytes += task_counts.GetMemoryUsage() + internal_task_counts.GetMemoryUsage();
+  bytes += (inst_executed_counts.GetSize() + collect_spec_counts.GetSize() + m_env_inputs.GetSize()) * sizeof(int);
+  bytes += (task_qualities.GetSize() + internal_task_qualities.GetSize() + rbins_total.GetSize() +
+            rbins_avail.GetSize()) * sizeof(double);
+  
+  if (m_cpu_test_info) bytes += sizeof(cCPUTestInfo);
+  if (knockout_stats) {
+    bytes += sizeof(cAnalyzeKnockouts);
+    for (int i = 0; i < knockout_stats->task_counts.GetSize(); i++) {
+      bytes += sizeof(Apto::Array<int>) + knockout_stats->task_counts[i].GetSize() * sizeof(int);
+    }
+  }
+  if (m_land) bytes += sizeof(cLandscape);
+  if (m_phenplast_stats) bytes += sizeof(cPhenPlastSummary) + m_phenplast_stats->m_task_probabilities.GetSize() * sizeof(double);
+  
+  return bytes;
+}
+
+
 void cAnalyzeGenotype::Initialize()
 {
   tDMSingleton<tDataCommandManager<cAnalyzeGenotype> >::Initialize(&cAnalyzeGenotype::buildDataCommandManager);
@@ -529,7 +615,7 @@ void cAnalyzeGenotype::CheckLand() const
 {
   if (m_land == NULL) {
     m_land = new cLandscape(m_world, m_genome);
-    m_land->SetCPUTestInfo(m_cpu_test_info);
+    if (m_cpu_test_info) m_land->SetCPUTestInfo(*m_cpu_test_info);
     m_land->SetDistance(1);
     m_land->Process(m_world->GetDefaultContext());
   }
@@ -551,7 +637,7 @@ void cAnalyzeGenotype::CheckPhenPlast() const
 void cAnalyzeGenotype::CalcLandscape(cAvidaContext& ctx)
 {
   if (m_land == NULL) m_land = new cLandscape(m_world, m_genome);
-  m_land->SetCPUTestInfo(m_cpu_test_info);
+  if (m_cpu_test_info) m_land->SetCPUTestInfo(*m_cpu_test_info);
   m_land->SetDistance(1);
   m_land->Process(ctx);
 }
@@ -27,7 +27,9 @@
 #include "avida/core/Genome.h"
 #include "avida/core/Properties.h"
 
+#include <climits>
 #include <fstream>
+#include <set>
 
 #include "cCPUMemory.h"
 #include "cGenotypeData.h"
@@ -70,6 +72,46 @@ public:
 };
 
 
+// Task counts as held by cAnalyzeGenotype: one byte per task while every count fits in a byte, as is nearly always
+// the case, and a full int per task otherwise
+class cAnalyzeTaskCounts
+{
+private:
+  Apto::Array<unsigned char> m_small;
+  Apto::Array<int> m_large;
+  
+public:
+  cAnalyzeTaskCounts() { ; }
+  
+  cAnalyzeTaskCounts& operator=(const Apto::Array<int>& counts)
+  {
+    bool fits = true;
+    for (int i = 0; i < counts.GetSize() && fits; i++) fits = (counts[i] >= 0 && counts[i] <= UCHAR_MAX);
+    if (fits) {
+      m_large.Resize(0);
+      m_small.Resize(counts.GetSize());
+      for (int i = 0; i < counts.GetSize(); i++) m_small[i] = static_cast<unsigned char>(counts[i]);
+    } else {
+      m_small.Resize(0);
+      m_large = counts;
+    }
+    return *this;
+  }
+  
+  int GetSize() const { return (m_large.GetSize()) ? m_large.GetSize() : m_small.GetSize(); }
+  int operator[](int index) const { return (m_large.GetSize()) ? m_large[index] : m_small[index]; }
+  
+  Apto::Array<int> Unpack() const
+  {
+    Apto::Array<int> counts(GetSize());
+    for (int i = 0; i < counts.GetSize(); i++) counts[i] = (*this)[i];
+    return counts;
+  }
+  
+  int GetMemoryUsage() const { return m_small.GetSize() * sizeof(unsigned char) + m_large.GetSize() * sizeof(int); }
+};
+
+
 class cAnalyzeGenotype
 {
   friend class ReadToken;
@@ -77,7 +119,7 @@ private:
   cWorld* m_world;
   Genome m_genome;        // Full Genome
   cString name;              // Name, if one was provided in loading
-  cCPUTestInfo m_cpu_test_info; // Use this test info
+  cCPUTestInfo* m_cpu_test_info; // Use this test info (NULL == default test info, allocated on first set)
   
   struct sGenotypeDatastore : public Apto::RefCountObject<Apto::ThreadSafe>
   {
@@ -125,9 +167,9 @@ private:
   int mate_id;
   cString executed_flags; // converted into a string
   Apto::Array<int> inst_executed_counts;
-  Apto::Array<int> task_counts;
+  cAnalyzeTaskCounts task_counts;
   Apto::Array<double> task_qualities;
-  Apto::Array<int> internal_task_counts;
+  cAnalyzeTaskCounts internal_task_counts;
   Apto::Array<double> internal_task_qualities;
   Apto::Array<double> rbins_total;
   Apto::Array<double> rbins_avail;
@@ -212,6 +254,10 @@ private:
   void SummarizePhenotypicPlasticity(const cPhenPlastGenotype& pp) const;
   
   static tDataCommandManager<cAnalyzeGenotype>* buildDataCommandManager();
+  
+  // All empty string members share one reference counted string rather than each holding its own
+  static const cString& emptyString();
+  static int internString(cString& str, Apto::Map<cString, cString>& pool);
 
 
 
@@ -229,7 +275,7 @@ public:
   void SetGenotypeData(int data_id, cGenotypeData* data);
   cGenotypeData* GetGenotypeData(ReadToken* tk, int data_id) const { tk->Validate(this); return m_data->dmap.GetWithDefault(data_id, NULL); }
   
-  void SetCPUTestInfo(cCPUTestInfo& in_cpu_test_info) { m_cpu_test_info = in_cpu_test_info; }
+  void SetCPUTestInfo(cCPUTestInfo& in_cpu_test_info);
   
   void Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info = NULL, cAnalyzeGenotype* parent_genotype = NULL, int num_trials = 1);
   void PrintTasks(std::ofstream& fp, int min_task = 0, int max_task = -1);
@@ -237,6 +283,13 @@ public:
   void PrintInternalTasks(std::ofstream& fp, int min_task = 0, int max_task = -1);
   void PrintInternalTasksQuality(std::ofstream& fp, int min_task = 0, int max_task = -1);
   void CalcLandscape(cAvidaContext& ctx);
+  
+  // Memory management: share string data with equal strings already in the pool (typically one pool per batch), and
+  // return the number of separately stored copies that were replaced
+  int Compact(Apto::Map<cString, cString>& pool);
+  // Estimated bytes held by this genotype; string data already in counted_strings (shared with genotypes counted
+  // before) is not counted again
+  int GetMemoryUsage(std::set<const char*>& counted_strings) const;
 
   // Set...
   void SetInstSet(const cString& inst_set);
@@ -412,7 +465,7 @@ public:
     if (args.HasString("binary")) return (task_counts[task_id] > 0);
     return task_counts[task_id];
   }
-  const Apto::Array<int>& GetTaskCounts() const { return task_counts; }
+  Apto::Array<int> GetTaskCounts() const { return task_counts.Unpack(); }
   cString DescTask(int task_id) const;
   
   double GetTaskQuality(int task_id) const {
@@ -40,10 +40,20 @@ using namespace Avida;
 cAnalyzeJobQueue::cAnalyzeJobQueue(cWorld* world)
 : m_world(world), m_last_jobid(0), m_jobs(0), m_pending(0), m_workers(Apto::Platform::AvailableCPUs())
 {
-  const int max_workers = world->GetConfig().MAX_CONCURRENCY.Get();
-  if (max_workers > 0 && max_workers < m_workers.GetSize()) m_workers.Resize(max_workers);
-  
   m_job_seed_rng = new Apto::RNG::AvidaRNG(world->GetRandom().GetInt(world->GetRandom().MaxSeed()));
+  setupWorkers(world->GetConfig().MAX_CONCURRENCY.Get());
+}
+
+cAnalyzeJobQueue::cAnalyzeJobQueue(cWorld* world, Apto::Random& seed_rng, int max_workers)
+: m_world(world), m_last_jobid(0), m_jobs(0), m_pending(0), m_workers(Apto::Platform::AvailableCPUs())
+{
+  m_job_seed_rng = new Apto::RNG::AvidaRNG(seed_rng.GetInt(seed_rng.MaxSeed()));
+  setupWorkers(max_workers);
+}
+
+void cAnalyzeJobQueue::setupWorkers(int max_workers)
+{
+  if (max_workers > 0 && max_workers < m_workers.GetSize()) m_workers.Resize(max_workers);
   
   if (m_workers.GetSize() > 1) {
     for (int i = 0; i < m_workers.GetSize(); i++) {
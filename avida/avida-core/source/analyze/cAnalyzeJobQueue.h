@@ -58,6 +58,7 @@ private:
   Apto::Array<cAnalyzeJobWorker*> m_workers;
 
 
+  void setupWorkers(int max_workers);
   void singleThreadedJobExecution(cAnalyzeJob* job);
   inline void queueJob(cAnalyzeJob* job);
 
@@ -69,6 +70,7 @@ private:
 
 public:
   cAnalyzeJobQueue(cWorld* world);
+  cAnalyzeJobQueue(cWorld* world, Apto::Random& seed_rng, int max_workers);
   ~cAnalyzeJobQueue();
 
   void AddJob(cAnalyzeJob* job);
@@ -0,0 +1,88 @@
+/*
+ *  cAnalyzeMultiRun.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cAnalyzeMultiRun.h"
+
+#include "apto/core/FileSystem.h"
+#include "apto/rng.h"
+#include "avida/Avida.h"
+
+#include "cAnalyze.h"
+#include "cAvidaContext.h"
+#include "cInitFile.h"
+#include "cUserFeedback.h"
+#include "cWorld.h"
+
+#include <iostream>
+
+using namespace std;
+using namespace Avida;
+
+
+void cAnalyzeMultiRun::AddRun(const cString& run_dir)
+{
+  m_run_dirs.Push(cString(Apto::FileSystem::GetAbsolutePath(Apto::String(run_dir), Apto::String(m_world->GetWorkingDir()))));
+}
+
+bool cAnalyzeMultiRun::LoadRunList(const cString& filename)
+{
+  cInitFile run_file(filename, m_world->GetWorkingDir());
+  if (!run_file.WasOpened()) {
+    const cUserFeedback& feedback = run_file.GetFeedback();
+    for (int i = 0; i < feedback.GetNumMessages(); i++) {
+      switch (feedback.GetMessageType(i)) {
+        case cUserFeedback::UF_ERROR:    cerr << "error: "; break;
+        case cUserFeedback::UF_WARNING:  cerr << "warning: "; break;
+        default: break;
+      };
+      cerr << feedback.GetMessage(i) << endl;
+    }
+    return false;
+  }
+  
+  for (int i = 0; i < run_file.GetNumLines(); i++) {
+    cString run_dir = run_file.GetLine(i);
+    run_dir.Trim();
+    if (run_dir.GetSize()) AddRun(run_dir);
+  }
+  
+  return true;
+}
+
+void cAnalyzeMultiRun::Run(const cString& analyze_file)
+{
+  // Each run resolves files against its own directory, so anchor the shared script to the world working directory
+  cString script(Apto::FileSystem::GetAbsolutePath(Apto::String(analyze_file), Apto::String(m_world->GetWorkingDir())));
+  
+  for (int i = 0; i < m_run_dirs.GetSize(); i++) {
+    // Every run starts from the configured seed, both for its own context and for the world's default context (used by
+    // lazily computed genotype statistics such as landscapes), so a run's results do not depend on the runs before it
+    m_world->GetRandom().ResetSeed(m_world->GetConfig().RANDOM_SEED.Get());
+    Apto::RNG::AvidaRNG rng(m_world->GetConfig().RANDOM_SEED.Get());
+    cAvidaContext ctx(&m_world->GetDriver(), rng);
+    ctx.SetAnalyzeMode();
+    
+    if (m_world->GetVerbosity() >= VERBOSE_ON) cout << "Analyzing run: " << m_run_dirs[i] << endl;
+    
+    cAnalyze analyze(m_world, ctx, m_run_dirs[i]);
+    analyze.RunFile(script);
+  }
+}
@@ -0,0 +1,69 @@
+/*
+ *  cAnalyzeMultiRun.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cAnalyzeMultiRun_h
+#define cAnalyzeMultiRun_h
+
+#include "apto/core.h"
+
+#include "cString.h"
+
+class cWorld;
+
+
+// cAnalyzeMultiRun
+// --------------------------------------------------------------------------------------------------------------
+//
+// Runs a single analyze script against many run (replicate) directories from one process.  The world, and thus the
+// configuration, instruction sets, environment and task library, is set up once and shared by all runs.  Runs are
+// processed one after another, each by its own cAnalyze object and context, starting from the configured random seed;
+// work within a run is spread over the analyze job queue (MAX_CONCURRENCY) as in single-run analyze mode.  Input files
+// named in the script are resolved relative to the run directory, and output files are written to the DATA_DIR of each
+// run directory.
+//
+// Runs are not analyzed concurrently: analyze commands report straight to cout, and lazily computed genotype statistics
+// (knockouts, landscapes, plasticity) as well as action commands draw on the world's default context, none of which
+// can be kept apart per run.
+//
+// Since the world is shared, scripts should not contain commands that modify it (CONFIG_SET, ENVIRONMENT, etc.).
+
+class cAnalyzeMultiRun
+{
+private:
+  cWorld* m_world;
+  Apto::Array<cString> m_run_dirs;
+  
+  
+  cAnalyzeMultiRun(); // @not_implemented
+  cAnalyzeMultiRun(const cAnalyzeMultiRun&); // @not_implemented
+  cAnalyzeMultiRun& operator=(const cAnalyzeMultiRun&); // @not_implemented
+  
+public:
+  cAnalyzeMultiRun(cWorld* world) : m_world(world) { ; }
+  
+  void AddRun(const cString& run_dir);
+  bool LoadRunList(const cString& filename);
+  int GetNumRuns() const { return m_run_dirs.GetSize(); }
+  
+  void Run(const cString& analyze_file);
+};
+
+#endif
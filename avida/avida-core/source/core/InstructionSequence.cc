@@ -36,11 +36,12 @@ const double MEMORY_SHRINK_TEST_FACTOR = 4.0;
 
 Avida::InstructionSequence::InstructionSequence(const InstructionSequence& seq)
 : GeneticRepresentation(seq), m_seq(seq.GetSize()), m_active_size(seq.GetSize())
+, m_fingerprint(seq.m_fingerprint), m_fingerprint_valid(seq.m_fingerprint_valid)
 {
   for (int i = 0; i < m_active_size; i++)  m_seq[i] = seq[i];
 }
 
-Avida::InstructionSequence::InstructionSequence(const Apto::String& str)
+Avida::InstructionSequence::InstructionSequence(const Apto::String& str) : m_fingerprint(0), m_fingerprint_valid(false)
 {
   m_seq.ResizeClear(str.GetSize());
   int size = 0;
@@ -152,6 +153,7 @@ bool Avida::Instruction::SetSymbol(const Apto::String& symbol)
 void Avida::InstructionSequence::adjustCapacity(int new_size)
 {
   assert(new_size > 0);
+  m_fingerprint_valid = false;
   
   // Make sure we're really changing the size...
   if (new_size == m_active_size) return;
@@ -189,6 +191,7 @@ void Avida::InstructionSequence::Copy(int to, int from)
 {
   assert(to   >= 0   && to   < m_active_size);
   assert(from >= 0   && from < m_active_size);
+  m_fingerprint_valid = false;
   m_seq[to] = m_seq[from];
 }
  
@@ -262,6 +265,7 @@ void Avida::InstructionSequence::Replace(int pos, int num_sites, const Instructi
   assert(pos + num_sites <= m_active_size); // Cannot extend past end!
   
   const int size_change = seq.GetSize() - num_sites;
+  m_fingerprint_valid = false;
   
   // First, get the size right
   if (size_change > 0) prepareInsert(pos, size_change);
@@ -349,7 +353,9 @@ void Avida::InstructionSequence::operator=(const InstructionSequence& other_seq)
   m_seq.ResizeClear(m_active_size);
   
   // Now that both code arrays are the same size, copy the other one over
-  for (int i = 0; i < m_active_size; i++) m_seq[i] = other_seq[i];
+  for (int i = 0; i < m_active_size; i++) m_seq[i] = other_seq.m_seq[i];
+  m_fingerprint = other_seq.m_fingerprint;
+  m_fingerprint_valid = other_seq.m_fingerprint_valid;
 }
 
 
@@ -428,6 +434,24 @@ int Avida::InstructionSequence::MinDistBetween(const Instruction& inst) const
 }
 
 
+unsigned long long Avida::InstructionSequence::computeFingerprint() const
+{
+  // FNV-1a over the length and every instruction, then the MurmurHash3 finalizer so that each bit of the result
+  // depends on the whole sequence (hash tables index with the low bits)
+  unsigned long long hash = 14695981039346656037ULL;
+  const unsigned long long prime = 1099511628211ULL;
+  for (int shift = 0; shift < 32; shift += 8) hash = (hash ^ ((m_active_size >> shift) & 0xff)) * prime;
+  for (int i = 0; i < m_active_size; i++) hash = (hash ^ m_seq[i].GetOp()) * prime;
+
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+
 Avida::InstructionSequence Avida::InstructionSequence::Crop(int start, int end) const
 {
   assert(end > start);                // Must have a positive length clip!
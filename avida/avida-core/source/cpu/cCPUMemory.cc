@@ -95,6 +95,7 @@ void cCPUMemory::Copy(int to, int from)
   assert(from >= 0);
   assert(from < m_seq.GetSize());
   
+  m_fingerprint_valid = false;
   m_seq[to] = m_seq[from];
   m_flag_array[to] = m_flag_array[from];
 }
@@ -143,6 +144,7 @@ void cCPUMemory::Replace(int pos, int num_sites, const InstructionSequence& geno
   assert(pos + num_sites <= m_active_size); // Cannot extend past end!
   
   const int size_change = genome.GetSize() - num_sites;
+  m_fingerprint_valid = false;
   
   // First, get the size right
   if (size_change > 0) prepareInsert(pos, size_change);
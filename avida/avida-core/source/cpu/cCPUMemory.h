@@ -74,6 +74,7 @@ public:
   
   void Clear()
 	{
+		m_fingerprint_valid = false;
 		for (int i = 0; i < m_active_size; i++) {
 			m_seq[i].SetOp(0);
 			m_flag_array[i] = 0;
@@ -254,15 +254,15 @@ tInstLib<cHardwareCPU::tMethod>* cHardwareCPU::initInstLib(void)
     tInstLibEntry<tMethod>("sense-faced-resource1", &cHardwareCPU::Inst_SenseFacedResource1, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     tInstLibEntry<tMethod>("sense-faced-resource2", &cHardwareCPU::Inst_SenseFacedResource2, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
 
-    tInstLibEntry<tMethod>("sense-react-NAND", &cHardwareCPU::Inst_SenseReactNAND, INST_CLASS_ENVIRONMENT, nInstFlag::STALL, "If NAND reaction exists, sense whether or not it is being rewarded, punished, or neither."),
-    tInstLibEntry<tMethod>("sense-react-NOT", &cHardwareCPU::Inst_SenseReactNOT, INST_CLASS_ENVIRONMENT, nInstFlag::STALL, "If NOT reaction exists, sense whether or not it is being rewarded, punished, or neither."),
-    tInstLibEntry<tMethod>("sense-react-AND", &cHardwareCPU::Inst_SenseReactAND, INST_CLASS_ENVIRONMENT, nInstFlag::STALL, "If AND reaction exists, sense whether or not it is being rewarded, punished, or neither."),
-    tInstLibEntry<tMethod>("sense-react-ORN", &cHardwareCPU::Inst_SenseReactORN, INST_CLASS_ENVIRONMENT, nInstFlag::STALL, "If ORN reaction exists, sense whether or not it is being rewarded, punished, or neither."),
-    tInstLibEntry<tMethod>("sense-react-OR", &cHardwareCPU::Inst_SenseReactOR, INST_CLASS_ENVIRONMENT, nInstFlag::STALL, "If OR reaction exists, sense whether or not it is being rewarded, punished, or neither."),
-    tInstLibEntry<tMethod>("sense-react-ANDN", &cHardwareCPU::Inst_SenseReactANDN, INST_CLASS_ENVIRONMENT, nInstFlag::STALL, "If ANDN reaction exists, sense whether or not it is being rewarded, punished, or neither."),
-    tInstLibEntry<tMethod>("sense-react-NOR", &cHardwareCPU::Inst_SenseReactNOR, INST_CLASS_ENVIRONMENT, nInstFlag::STALL, "If NOR reaction exists, sense whether or not it is being rewarded, punished, or neither."),
-    tInstLibEntry<tMethod>("sense-react-XOR", &cHardwareCPU::Inst_SenseReactXOR, INST_CLASS_ENVIRONMENT, nInstFlag::STALL, "If XOR reaction exists, sense whether or not it is being rewarded, punished, or neither."),
-    tInstLibEntry<tMethod>("sense-react-EQU", &cHardwareCPU::Inst_SenseReactEQU, INST_CLASS_ENVIRONMENT, nInstFlag::STALL, "If EQU reaction exists, sense whether or not it is being rewarded, punished, or neither."),
+    tInstLibEntry<tMethod>("sense-react-NAND", &cHardwareCPU::Inst_SenseReactNAND, INST_CLASS_ENVIRONMENT, nInstFlag::READS_REACTION_VALUES, "If NAND reaction exists, sense whether or not it is being rewarded, punished, or neither."),
+    tInstLibEntry<tMethod>("sense-react-NOT", &cHardwareCPU::Inst_SenseReactNOT, INST_CLASS_ENVIRONMENT, nInstFlag::READS_REACTION_VALUES, "If NOT reaction exists, sense whether or not it is being rewarded, punished, or neither."),
+    tInstLibEntry<tMethod>("sense-react-AND", &cHardwareCPU::Inst_SenseReactAND, INST_CLASS_ENVIRONMENT, nInstFlag::READS_REACTION_VALUES, "If AND reaction exists, sense whether or not it is being rewarded, punished, or neither."),
+    tInstLibEntry<tMethod>("sense-react-ORN", &cHardwareCPU::Inst_SenseReactORN, INST_CLASS_ENVIRONMENT, nInstFlag::READS_REACTION_VALUES, "If ORN reaction exists, sense whether or not it is being rewarded, punished, or neither."),
+    tInstLibEntry<tMethod>("sense-react-OR", &cHardwareCPU::Inst_SenseReactOR, INST_CLASS_ENVIRONMENT, nInstFlag::READS_REACTION_VALUES, "If OR reaction exists, sense whether or not it is being rewarded, punished, or neither."),
+    tInstLibEntry<tMethod>("sense-react-ANDN", &cHardwareCPU::Inst_SenseReactANDN, INST_CLASS_ENVIRONMENT, nInstFlag::READS_REACTION_VALUES, "If ANDN reaction exists, sense whether or not it is being rewarded, punished, or neither."),
+    tInstLibEntry<tMethod>("sense-react-NOR", &cHardwareCPU::Inst_SenseReactNOR, INST_CLASS_ENVIRONMENT, nInstFlag::READS_REACTION_VALUES, "If NOR reaction exists, sense whether or not it is being rewarded, punished, or neither."),
+    tInstLibEntry<tMethod>("sense-react-XOR", &cHardwareCPU::Inst_SenseReactXOR, INST_CLASS_ENVIRONMENT, nInstFlag::READS_REACTION_VALUES, "If XOR reaction exists, sense whether or not it is being rewarded, punished, or neither."),
+    tInstLibEntry<tMethod>("sense-react-EQU", &cHardwareCPU::Inst_SenseReactEQU, INST_CLASS_ENVIRONMENT, nInstFlag::READS_REACTION_VALUES, "If EQU reaction exists, sense whether or not it is being rewarded, punished, or neither."),
 
     tInstLibEntry<tMethod>("if-resources", &cHardwareCPU::Inst_IfResources, INST_CLASS_CONDITIONAL, nInstFlag::STALL),
     tInstLibEntry<tMethod>("collect", &cHardwareCPU::Inst_Collect, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
@@ -793,6 +793,8 @@ cHardwareCPU::cHardwareCPU(cAvidaContext& ctx, cWorld* world, cOrganism* in_orga
   m_constitutive_regulation = m_world->GetConfig().CONSTITUTIVE_REGULATION.Get();
 
   m_slip_read_head = !m_world->GetConfig().SLIP_COPY_MODE.Get();
+  
+  m_sense_react_lib_size = -1;
 
   // Initialize memory...
   const Genome& in_genome = in_organism->GetGenome();
@@ -4572,24 +4574,31 @@ bool cHardwareCPU::Inst_SenseFacedHabitat(cAvidaContext& ctx)
 // --- REACTION SENSOR INSTRUCTIONS ---
 ////////////////////////////////////////
 /* DoSenseReact
-  Given the name of a reaction, push feedback to avida cpu stack according to the following rule:
+  Given one of the sense-react reactions, push feedback to avida cpu stack according to the following rule:
    - Push(-1) if current reaction value < REACTION_SENSORS_NEUTRAL
    - Push(1) if current reaction value > REACTION_SENSORS_NEUTRAL
    - Push(0) if current reaction value == REACTION_SENSORS_NEUTRAL
 */
-bool cHardwareCPU::DoSenseReact(cAvidaContext& ctx, const cString& reaction_name)
+bool cHardwareCPU::DoSenseReact(cAvidaContext& ctx, int sensor)
 {
   // If reaction sensors are disabled, bail (NOP out).
   if (m_world->GetConfig().DISABLE_REACTION_SENSORS.Get()) return true;
   // What reaction value is considered neutral?
   const double neutral_val = m_world->GetConfig().REACTION_SENSORS_NEUTRAL.Get();
 
-  const cReactionLib & reaction_lib = m_world->GetEnvironment().GetReactionLib();
-  cReaction* reaction = reaction_lib.GetReaction(reaction_name);
+  const cEnvironment& env = m_world->GetEnvironment();
+  if (m_sense_react_lib_size != env.GetNumReactions()) {
+    static const char* const reaction_names[NUM_SENSE_REACTIONS] = {
+      "NAND", "NOT", "AND", "ORN", "OR", "ANDN", "NOR", "XOR", "EQU"
+    };
+    for (int i = 0; i < NUM_SENSE_REACTIONS; i++) m_sense_react_ids[i] = env.GetReactionID(reaction_names[i]);
+    m_sense_react_lib_size = env.GetNumReactions();
+  }
 
-  if (reaction == NULL) return true;  // Reaction doesn't exist.
+  const int reaction_id = m_sense_react_ids[sensor];
+  if (reaction_id < 0) return true;  // Reaction doesn't exist.
 
-  const double val = reaction->GetValue();
+  const double val = env.GetReactionValue(reaction_id);
   if (val < neutral_val) {
     StackPush(-1);
   } else if (val > neutral_val) {
@@ -4602,39 +4611,39 @@ bool cHardwareCPU::DoSenseReact(cAvidaContext& ctx, const cString& reaction_name
 
 bool cHardwareCPU::Inst_SenseReactNAND(cAvidaContext& ctx)
 {
-  return DoSenseReact(ctx, "NAND");
+  return DoSenseReact(ctx, SENSE_REACT_NAND);
 }
 bool cHardwareCPU::Inst_SenseReactNOT(cAvidaContext& ctx)
 {
-  return DoSenseReact(ctx, "NOT");
+  return DoSenseReact(ctx, SENSE_REACT_NOT);
 }
 bool cHardwareCPU::Inst_SenseReactAND(cAvidaContext& ctx)
 {
-  return DoSenseReact(ctx, "AND");
+  return DoSenseReact(ctx, SENSE_REACT_AND);
 }
 bool cHardwareCPU::Inst_SenseReactORN(cAvidaContext& ctx)
 {
-  return DoSenseReact(ctx, "ORN");
+  return DoSenseReact(ctx, SENSE_REACT_ORN);
 }
 bool cHardwareCPU::Inst_SenseReactOR(cAvidaContext& ctx)
 {
-  return DoSenseReact(ctx, "OR");
+  return DoSenseReact(ctx, SENSE_REACT_OR);
 }
 bool cHardwareCPU::Inst_SenseReactANDN(cAvidaContext& ctx)
 {
-  return DoSenseReact(ctx, "ANDN");
+  return DoSenseReact(ctx, SENSE_REACT_ANDN);
 }
 bool cHardwareCPU::Inst_SenseReactNOR(cAvidaContext& ctx)
 {
-  return DoSenseReact(ctx, "NOR");
+  return DoSenseReact(ctx, SENSE_REACT_NOR);
 }
 bool cHardwareCPU::Inst_SenseReactXOR(cAvidaContext& ctx)
 {
-  return DoSenseReact(ctx, "XOR");
+  return DoSenseReact(ctx, SENSE_REACT_XOR);
 }
 bool cHardwareCPU::Inst_SenseReactEQU(cAvidaContext& ctx)
 {
-  return DoSenseReact(ctx, "EQU");
+  return DoSenseReact(ctx, SENSE_REACT_EQU);
 }
 
 
@@ -6135,8 +6144,8 @@ bool cHardwareCPU::Inst_RotateToMostNeedy(cAvidaContext&)
   double neighbor_energy;
 
   // Look at the energy levels of neighbors
-  for (int i = 0; i < mycell.ConnectionList().GetSize(); i++) {
-    mycell.ConnectionList().CircNext();
+  for (int i = 0; i < mycell.GetNumNeighbors(); i++) {
+    mycell.RotateNext();
     neighbor = m_organism->GetNeighbor();
 
     // If this neighbor is alive and has a request for energy or we're allowing pushing of energy, look at it
@@ -6153,7 +6162,7 @@ bool cHardwareCPU::Inst_RotateToMostNeedy(cAvidaContext&)
 
   //Rotate to face the most needy neighbor
   for (int i = 0; i < num_rotations; i++) {
-    mycell.ConnectionList().CircNext();
+    mycell.RotateNext();
   }
 
   return true;
@@ -6304,6 +6313,9 @@ bool cHardwareCPU::DonateResourceX(cAvidaContext& ctx, const int res_id)
   }
 
   cPopulation& pop = m_world->GetPopulation();
+  if (pop.GetCell(current_cell).GetNumNeighbors() == 0) {
+    return false;
+  }
   faced_cell = pop.GetCell(current_cell).GetCellFaced().GetID();
 
   if (faced_cell == -1) {
@@ -8635,6 +8647,7 @@ bool cHardwareCPU::Inst_SenseTargetFaced(cAvidaContext&)
   }
 
   cPopulationCell& mycell = pop.GetCell(cellid);
+  if (mycell.GetNumNeighbors() == 0) return false;
 
   int cell_data = mycell.GetCellFaced().GetCellData(); //absolute id of faced cell
   int val = 0;
@@ -8752,6 +8765,7 @@ bool cHardwareCPU::Inst_SensePheromoneFaced(cAvidaContext& ctx)
 
   cPopulation& pop = m_world->GetPopulation();
   cPopulationCell& mycell = pop.GetCell(cellid);
+  if (mycell.GetNumNeighbors() == 0) return false;
 
   int fcellid = mycell.GetCellFaced().GetID(); //absolute id of faced cell
 
@@ -8786,6 +8800,7 @@ bool cHardwareCPU::Inst_Exploit(cAvidaContext& ctx)
   if (cellid == -1) return false;
 
   cPopulationCell& mycell = pop.GetCell(cellid);
+  if (mycell.GetNumNeighbors() == 0) return false;
   cDeme &deme = pop.GetDeme(pop.GetCell(cellid).GetDemeID());
   const cResourceCount& deme_resource_count = deme.GetDemeResourceCount();
   Apto::Array<double> cell_resources;
@@ -8795,7 +8810,7 @@ bool cHardwareCPU::Inst_Exploit(cAvidaContext& ctx)
     num_rotations = ctx.GetRandom().GetUInt(m_organism->GetNeighborhoodSize());
   } else {
     // Find which neighbor has the strongest pheromone
-    for (int i = 0; i < mycell.ConnectionList().GetSize(); i++) {
+    for (int i = 0; i < mycell.GetNumNeighbors(); i++) {
 
       phero_amount = 0;
       cell_resources = deme_resource_count.GetCellResources(deme.GetRelativeCellID(mycell.GetCellFaced().GetID()), ctx);
@@ -8811,13 +8826,13 @@ bool cHardwareCPU::Inst_Exploit(cAvidaContext& ctx)
         max_pheromone = phero_amount;
       }
 
-      mycell.ConnectionList().CircNext();
+      mycell.RotateNext();
     }
   }
 
   // Rotate until we face the neighbor with the strongest pheromone.
   // If there was no winner, just move forward.
-  for (int i = 0; i < num_rotations; i++) mycell.ConnectionList().CircNext();
+  for (int i = 0; i < num_rotations; i++) mycell.RotateNext();
 
   m_organism->Move(ctx);
 
@@ -8844,6 +8859,7 @@ bool cHardwareCPU::Inst_ExploitForward5(cAvidaContext& ctx)
   }
 
   cPopulationCell& mycell = pop.GetCell(cellid);
+  if (mycell.GetNumNeighbors() == 0) return false;
   cDeme &deme = pop.GetDeme(pop.GetCell(cellid).GetDemeID());
   const cResourceCount& deme_resource_count = deme.GetDemeResourceCount();
   Apto::Array<double> cell_resources;
@@ -8853,11 +8869,11 @@ bool cHardwareCPU::Inst_ExploitForward5(cAvidaContext& ctx)
     num_rotations = ctx.GetRandom().GetUInt(m_organism->GetNeighborhoodSize());
   } else {
     // Find which neighbor has the strongest pheromone
-    for (int i = 0; i < mycell.ConnectionList().GetSize(); i++) {
+    for (int i = 0; i < mycell.GetNumNeighbors(); i++) {
 
       // Skip the cells in the back
       if (i == 3 || i == 4 || i == 5) {
-        mycell.ConnectionList().CircNext();
+        mycell.RotateNext();
         continue;
       }
 
@@ -8875,14 +8891,14 @@ bool cHardwareCPU::Inst_ExploitForward5(cAvidaContext& ctx)
         max_pheromone = phero_amount;
       }
 
-      mycell.ConnectionList().CircNext();
+      mycell.RotateNext();
     }
   }
 
   // Rotate until we face the neighbor with the strongest pheromone.
   // If there was no winner, just move forward.
   for (int i = 0; i < num_rotations; i++) {
-    mycell.ConnectionList().CircNext();
+    mycell.RotateNext();
   }
 
   m_organism->Move(ctx);
@@ -8909,6 +8925,7 @@ bool cHardwareCPU::Inst_ExploitForward3(cAvidaContext& ctx)
   }
 
   cPopulationCell& mycell = pop.GetCell(cellid);
+  if (mycell.GetNumNeighbors() == 0) return false;
   cDeme &deme = pop.GetDeme(pop.GetCell(cellid).GetDemeID());
   const cResourceCount& deme_resource_count = deme.GetDemeResourceCount();
   Apto::Array<double> cell_resources;
@@ -8918,11 +8935,11 @@ bool cHardwareCPU::Inst_ExploitForward3(cAvidaContext& ctx)
     num_rotations = ctx.GetRandom().GetUInt(m_organism->GetNeighborhoodSize());
   } else {
     // Find which neighbor has the strongest pheromone
-    for (int i = 0; i < mycell.ConnectionList().GetSize(); i++) {
+    for (int i = 0; i < mycell.GetNumNeighbors(); i++) {
 
       // Skip the cells in the back
       if (i == 2 || i == 3 || i == 4 || i == 5 || i == 6) {
-        mycell.ConnectionList().CircNext();
+        mycell.RotateNext();
         continue;
       }
 
@@ -8940,14 +8957,14 @@ bool cHardwareCPU::Inst_ExploitForward3(cAvidaContext& ctx)
         max_pheromone = phero_amount;
       }
 
-      mycell.ConnectionList().CircNext();
+      mycell.RotateNext();
     }
   }
 
   // Rotate until we face the neighbor with the strongest pheromone.
   // If there was no winner, just move forward.
   for (int i = 0; i < num_rotations; i++) {
-    mycell.ConnectionList().CircNext();
+    mycell.RotateNext();
   }
 
   m_organism->Move(ctx);
@@ -8992,26 +9009,27 @@ bool cHardwareCPU::Inst_MoveTarget(cAvidaContext& ctx)
   }
 
   cPopulationCell& mycell = pop.GetCell(cellid);
+  if (mycell.GetNumNeighbors() == 0) return true;
 
   int cell_data;
 
   cPopulationCell faced = mycell.GetCellFaced();
 
   // Find if any neighbor is a target
-  for (int i = 0; i < mycell.ConnectionList().GetSize(); i++) {
+  for (int i = 0; i < mycell.GetNumNeighbors(); i++) {
     cell_data = mycell.GetCellFaced().GetCellData();
 
     if (cell_data > 0) {
       num_rotations = i;
     }
 
-    mycell.ConnectionList().CircNext();
+    mycell.RotateNext();
   }
 
   // Rotate until we face the neighbor with a target.
   // If there was no winner, just move forward.
   for (int i = 0; i < num_rotations; i++) {
-    mycell.ConnectionList().CircNext();
+    mycell.RotateNext();
   }
 
   m_organism->Move(ctx);
@@ -9038,17 +9056,18 @@ bool cHardwareCPU::Inst_MoveTargetForward5(cAvidaContext& ctx)
   }
 
   cPopulationCell& mycell = pop.GetCell(cellid);
+  if (mycell.GetNumNeighbors() == 0) return false;
 
   int cell_data;
 
   cPopulationCell faced = mycell.GetCellFaced();
 
   // Find if any neighbor is a target
-  for (int i = 0; i < mycell.ConnectionList().GetSize(); i++) {
+  for (int i = 0; i < mycell.GetNumNeighbors(); i++) {
 
     // Skip the cells behind
     if (i == 3 || i == 4 || i == 5) {
-      mycell.ConnectionList().CircNext();
+      mycell.RotateNext();
       continue;
     }
 
@@ -9058,13 +9077,13 @@ bool cHardwareCPU::Inst_MoveTargetForward5(cAvidaContext& ctx)
       num_rotations = i;
     }
 
-    mycell.ConnectionList().CircNext();
+    mycell.RotateNext();
   }
 
   // Rotate until we face the neighbor with a target.
   // If there was no winner, just move forward.
   for (int i = 0; i < num_rotations; i++) {
-    mycell.ConnectionList().CircNext();
+    mycell.RotateNext();
   }
 
   m_organism->Move(ctx);
@@ -9090,17 +9109,18 @@ bool cHardwareCPU::Inst_MoveTargetForward3(cAvidaContext& ctx)
   }
 
   cPopulationCell& mycell = pop.GetCell(cellid);
+  if (mycell.GetNumNeighbors() == 0) return false;
 
   int cell_data;
 
   cPopulationCell faced = mycell.GetCellFaced();
 
   // Find if any neighbor is a target
-  for (int i = 0; i < mycell.ConnectionList().GetSize(); i++) {
+  for (int i = 0; i < mycell.GetNumNeighbors(); i++) {
 
     // Skip the cells behind
     if (i==2 || i == 3 || i == 4 || i == 5 || i == 6) {
-      mycell.ConnectionList().CircNext();
+      mycell.RotateNext();
       continue;
     }
 
@@ -9110,13 +9130,13 @@ bool cHardwareCPU::Inst_MoveTargetForward3(cAvidaContext& ctx)
       num_rotations = i;
     }
 
-    mycell.ConnectionList().CircNext();
+    mycell.RotateNext();
   }
 
   // Rotate until we face the neighbor with a target.
   // If there was no winner, just move forward.
   for (int i = 0; i < num_rotations; i++) {
-    mycell.ConnectionList().CircNext();
+    mycell.RotateNext();
   }
 
   m_organism->Move(ctx);
@@ -9139,6 +9159,7 @@ bool cHardwareCPU::Inst_SuperMove(cAvidaContext& ctx)
   }
 
   cPopulationCell& mycell = pop.GetCell(cellid);
+  if (mycell.GetNumNeighbors() == 0) return false;
   cDeme &deme = pop.GetDeme(pop.GetCell(cellid).GetDemeID());
   const cResourceCount& deme_resource_count = deme.GetDemeResourceCount();
   int relative_cell_id = deme.GetRelativeCellID(cellid);
@@ -9152,7 +9173,7 @@ bool cHardwareCPU::Inst_SuperMove(cAvidaContext& ctx)
 
 
   // Find the neighbor with highest pheromone -- medium priority
-  for (int i = 0; i < mycell.ConnectionList().GetSize(); i++) {
+  for (int i = 0; i < mycell.GetNumNeighbors(); i++) {
 
     phero_amount = 0;
     cell_resources = deme_resource_count.GetCellResources(deme.GetRelativeCellID(mycell.GetCellFaced().GetID()), ctx);
@@ -9168,24 +9189,24 @@ bool cHardwareCPU::Inst_SuperMove(cAvidaContext& ctx)
       max_pheromone = phero_amount;
     }
 
-    mycell.ConnectionList().CircNext();
+    mycell.RotateNext();
   }
 
   // Find if any neighbor is a target -- highest priority
-  for (int i = 0; i < mycell.ConnectionList().GetSize(); i++) {
+  for (int i = 0; i < mycell.GetNumNeighbors(); i++) {
     cell_data = mycell.GetCellFaced().GetCellData();
 
     if (cell_data > 0) {
       num_rotations = i;
     }
 
-    mycell.ConnectionList().CircNext();
+    mycell.RotateNext();
   }
 
   // Rotate until we face the neighbor with a target.
   // If there was no winner, just move forward.
   for (int i = 0; i < num_rotations; i++) {
-    mycell.ConnectionList().CircNext();
+    mycell.RotateNext();
   }
 
   m_organism->Move(ctx);
@@ -146,6 +146,13 @@ protected:
   Apto::Array<cPromoter> m_promoters;
   // Promoter Model -->
 
+  // Reactions read by the sense-react instructions.  Their ids are resolved by name on first use and kept until the
+  // environment's reaction library changes (-1 if the reaction does not exist).
+  enum { SENSE_REACT_NAND = 0, SENSE_REACT_NOT, SENSE_REACT_AND, SENSE_REACT_ORN, SENSE_REACT_OR, SENSE_REACT_ANDN,
+    SENSE_REACT_NOR, SENSE_REACT_XOR, SENSE_REACT_EQU, NUM_SENSE_REACTIONS };
+  int m_sense_react_ids[NUM_SENSE_REACTIONS];
+  int m_sense_react_lib_size;
+
   // <-- Epigenetic State
   bool m_epigenetic_state;
   int m_epigenetic_saved_reg[NUM_REGISTERS];
@@ -528,7 +535,7 @@ private:
   bool Inst_SenseFacedHabitat(cAvidaContext& ctx);
 
   // Reaction-specific sensors. NOP behavior if reaction does not exist.
-  bool DoSenseReact(cAvidaContext& ctx, const cString & reaction_name);
+  bool DoSenseReact(cAvidaContext& ctx, int sensor);
   bool Inst_SenseReactNAND(cAvidaContext& ctx);
   bool Inst_SenseReactNOT(cAvidaContext& ctx);
   bool Inst_SenseReactAND(cAvidaContext& ctx);
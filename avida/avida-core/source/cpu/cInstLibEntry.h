@@ -32,6 +32,7 @@ namespace nInstFlag {
   const unsigned int PROMOTER = 0x20;
   const unsigned int TERMINATOR = 0x40;
   const unsigned int IMMEDIATE_VALUE = 0x80;
+  const unsigned int READS_REACTION_VALUES = 0x100; // Stalls speculation only while reaction values may change
 }
 
 enum InstructionClass {
@@ -86,6 +87,7 @@ public:
   inline bool ShouldStall() const { return (m_flags & nInstFlag::STALL) != 0; }
   inline bool ShouldSleep() const { return (m_flags & nInstFlag::SLEEP) != 0; }
   inline bool IsImmediateValue() const { return (m_flags & nInstFlag::IMMEDIATE_VALUE) != 0; }
+  inline bool ReadsReactionValues() const { return (m_flags & nInstFlag::READS_REACTION_VALUES) != 0; }
 };
 
 #endif
@@ -27,6 +27,7 @@
 #include "cArgContainer.h"
 #include "cArgSchema.h"
 #include "cAvidaContext.h"
+#include "cEnvironment.h"
 #include "cStringUtil.h"
 #include "cUserFeedback.h"
 #include "cWorld.h"
@@ -87,6 +88,11 @@ Instruction cInstSet::GetRandomInst(cAvidaContext& ctx) const
   return Instruction(inst_ndx);
 }
 
+bool cInstSet::ReactionValuesFixed() const
+{
+  return m_world->GetEnvironment().ReactionValuesFixed();
+}
+
 
 
 Instruction cInstSet::ActivateNullInst()
@@ -134,6 +134,7 @@ public:
   }
 
   Instruction GetRandomInst(cAvidaContext& ctx) const;
+  bool ReactionValuesFixed() const;
   int GetRandFunctionIndex(cAvidaContext& ctx) const { return m_lib_name_map[ GetRandomInst(ctx).GetOp() ].lib_fun_id; }
 
   int GetSize() const { return m_lib_name_map.GetSize(); }
@@ -157,7 +158,11 @@ public:
   bool IsLabel(const Instruction& inst) const { return m_inst_lib->Get(GetLibFunctionIndex(inst)).IsLabel(); }
   bool IsPromoter(const Instruction& inst) const { return m_inst_lib->Get(GetLibFunctionIndex(inst)).IsPromoter(); }
   bool IsTerminator(const Instruction& inst) const { return m_inst_lib->Get(GetLibFunctionIndex(inst)).IsTerminator(); }
-  bool ShouldStall(const Instruction& inst) const { return m_inst_lib->Get(GetLibFunctionIndex(inst)).ShouldStall(); }
+  bool ShouldStall(const Instruction& inst) const
+  {
+    const cInstLibEntry& entry = m_inst_lib->Get(GetLibFunctionIndex(inst));
+    return entry.ShouldStall() || (entry.ReadsReactionValues() && !ReactionValuesFixed());
+  }
   bool ShouldSleep(const Instruction& inst) const { return m_inst_lib->Get(GetLibFunctionIndex(inst)).ShouldSleep(); }
   bool IsImmediateValue(const Instruction& inst) const { return (inst != GetInstError() && m_inst_lib->Get(GetLibFunctionIndex(inst)).IsImmediateValue()); }
   
@@ -221,6 +221,8 @@ public:
   void IncNumPreyOrganisms() { ; }
   void IncNumPredOrganisms() { ; }
   void IncNumTopPredOrganisms() { ; }
+  void UpdateCellOccupancy() { ; }
+  const cOccupancyIndex* GetOccupancyIndex() { return NULL; }
   void AttackFacedOrg(cAvidaContext& ctx, int) { ; }
   void TryWriteBirthLocData(int) { ; }
   void InjectPreyClone(cAvidaContext& ctx, int gen_id) { ; }
@@ -46,6 +46,7 @@ cDeme::cDeme()
   : _id(0)
   , width(0)
   , replicateDeme(false)
+  , m_repro_pending(false)
   , treatable(false)
   , cur_birth_count(0)
   , last_birth_count(0)
@@ -76,6 +77,7 @@ cDeme::cDeme()
   , avg_founder_generation(0.0)
   , generations_per_lifetime(0.0)
   , deme_resource_count(0)
+  , m_res_steps_applied(0)
   , m_germline_genotype_id(0)
   , points(0)
   , migrations_out(0)
@@ -106,6 +108,7 @@ cDeme& cDeme::operator=(const cDeme& in_deme)
   cell_ids                            = in_deme.cell_ids;
   width                               = in_deme.width;
   replicateDeme                       = in_deme.replicateDeme;
+  m_repro_pending                     = in_deme.m_repro_pending;
   treatable                           = in_deme.treatable;
   treatment_ages                      = in_deme.treatment_ages;
   cur_birth_count                     = in_deme.cur_birth_count;
@@ -203,6 +206,7 @@ void cDeme::Setup(int id, const Apto::Array<int> & in_cells, int in_width, cWorl
   m_world = world;
 
   replicateDeme = false;
+  m_repro_pending = false;
 
   _current_merit = 1.0;
   _next_merit = 1.0;
@@ -332,6 +336,16 @@ int cDeme::GetNumOrgsWithOpinion() const
   return count;
 }
 
+void cDeme::SyncResourceTime() const
+{
+  const cPopulation& pop = m_world->GetPopulation();
+  const int pending = pop.GetDemeResourceSteps() - m_res_steps_applied;
+  if (pending > 0) {
+    deme_resource_count.Update(pending * pop.GetDemeResourceStepSize());
+    m_res_steps_applied += pending;
+  }
+}
+
 void cDeme::ProcessPreUpdate()
 {
   deme_resource_count.SetSpatialUpdate(m_world->GetStats().GetUpdate());
@@ -536,6 +550,7 @@ void cDeme::Reset(cAvidaContext& ctx, bool resetResources, double deme_energy)
   consecutiveSuccessfulEventPeriods = 0;
   
   replicateDeme = false;
+  m_repro_pending = false;
   
   total_energy_donated = 0.0;
   total_energy_received = 0.0;
@@ -558,6 +573,7 @@ void cDeme::Reset(cAvidaContext& ctx, bool resetResources, double deme_energy)
   }
   
   if (resetResources) {
+    SyncResourceTime();
     deme_resource_count.ReinitializeResources(ctx, additional_resource);
   }
 
@@ -701,6 +717,7 @@ void cDeme::UpdateDemeMerit(cDeme& source) {
 
 
 void cDeme::ModifyDemeResCount(cAvidaContext& ctx, const Apto::Array<double>& res_change, const int absolute_cell_id) {
+  SyncResourceTime();
   // find relative cell_id in deme resource count
   const int relative_cell_id = GetRelativeCellID(absolute_cell_id);
   deme_resource_count.ModifyCell(ctx, res_change, relative_cell_id);
@@ -749,6 +766,7 @@ void cDeme::SetupDemeRes(int id, cResource * res, int verbosity, cWorld* world)
 
 double cDeme::GetCellEnergy(int absolute_cell_id, cAvidaContext& ctx) const
 {
+  SyncResourceTime();
   assert(cell_ids[0] <= absolute_cell_id);
   assert(absolute_cell_id <= cell_ids[cell_ids.GetSize()-1]);
 
@@ -769,6 +787,7 @@ double cDeme::GetCellEnergy(int absolute_cell_id, cAvidaContext& ctx) const
 
 double cDeme::GetAndClearCellEnergy(int absolute_cell_id, cAvidaContext& ctx) 
 {
+  SyncResourceTime();
   assert(cell_ids[0] <= absolute_cell_id);
   assert(absolute_cell_id <= cell_ids[cell_ids.GetSize()-1]);
   
@@ -792,6 +811,7 @@ double cDeme::GetAndClearCellEnergy(int absolute_cell_id, cAvidaContext& ctx)
 
 void cDeme::GiveBackCellEnergy(int absolute_cell_id, double value, cAvidaContext& ctx) 
 {
+  SyncResourceTime();
   assert(cell_ids[0] <= absolute_cell_id);
   assert(absolute_cell_id <= cell_ids[cell_ids.GetSize()-1]);
   
@@ -1135,6 +1155,7 @@ void cDeme::AddEventEventNUniqueIndividualsMovedIntoTargetPred(int times)
 
 void cDeme::AddPheromone(int absolute_cell_id, double value, cAvidaContext& ctx) 
 {
+  SyncResourceTime();
   assert(cell_ids[0] <= absolute_cell_id);
   assert(absolute_cell_id <= cell_ids[cell_ids.GetSize()-1]);
   
@@ -1167,6 +1188,7 @@ void cDeme::AddPheromone(int absolute_cell_id, double value, cAvidaContext& ctx)
 
 double cDeme::GetSpatialResource(int rel_cellid, int resource_id, cAvidaContext& ctx) const 
 {
+  SyncResourceTime();
   assert(rel_cellid >= 0);
   assert(rel_cellid < GetSize());
   assert(resource_id >= 0);
@@ -1178,6 +1200,7 @@ double cDeme::GetSpatialResource(int rel_cellid, int resource_id, cAvidaContext&
 
 void cDeme::AdjustSpatialResource(cAvidaContext& ctx, int rel_cellid, int resource_id, double amount)
 {
+  SyncResourceTime();
   assert(rel_cellid >= 0);
   assert(rel_cellid < GetSize());
   assert(resource_id >= 0);
@@ -1192,6 +1215,7 @@ void cDeme::AdjustSpatialResource(cAvidaContext& ctx, int rel_cellid, int resour
 
 void cDeme::AdjustResource(cAvidaContext& ctx, int resource_id, double amount)
 {
+  SyncResourceTime();
   double new_amount = deme_resource_count.Get(ctx, resource_id) + amount;
   deme_resource_count.Set(ctx, resource_id, new_amount);
 }
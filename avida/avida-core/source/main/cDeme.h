@@ -58,6 +58,7 @@ private:
   int width; //!< Width of this deme.
 
   bool replicateDeme;
+  bool m_repro_pending; //!< Queued for implicit replication at the end of the update (deme block scheduling).
   bool treatable;
   std::set<int> treatment_ages;
 
@@ -115,7 +116,8 @@ private:
 
   cDeme(const cDeme&); // @not_implemented
   
-  cResourceCount deme_resource_count; //!< Resources available to the deme
+  mutable cResourceCount deme_resource_count; //!< Resources available to the deme
+  mutable int m_res_steps_applied; //!< Population resource steps already added to deme_resource_count
   Apto::Array<int> energy_res_ids; //!< IDs of energy resources
   
   Apto::Array<cDemeCellEvent, Apto::Smart> cell_events;
@@ -200,6 +202,9 @@ public:
 
   bool TestReplication() const { return replicateDeme; }
   void ReplicateDeme() { replicateDeme = true; }
+  void ClearReplication() { replicateDeme = false; }
+  bool IsReproPending() const { return m_repro_pending; }
+  void SetReproPending(bool pending) { m_repro_pending = pending; }
 
   bool isTreatable() const { return treatable; }
   void setTreatable(bool value) { treatable = value; }
@@ -260,9 +265,9 @@ public:
   //! Called when an organism living in a cell in this deme is about to be killed.
   void OrganismDeath(cPopulationCell& cell);
   
-  const cResourceCount& GetDemeResourceCount() const { return deme_resource_count; }
-  cResourceCount& GetDemeResources() { return deme_resource_count; }
-  void SetResource(cAvidaContext& ctx, int id, double new_level) { deme_resource_count.Set(ctx, id, new_level); }
+  const cResourceCount& GetDemeResourceCount() const { SyncResourceTime(); return deme_resource_count; }
+  cResourceCount& GetDemeResources() { SyncResourceTime(); return deme_resource_count; }
+  void SetResource(cAvidaContext& ctx, int id, double new_level) { SyncResourceTime(); deme_resource_count.Set(ctx, id, new_level); }
   double GetSpatialResource(int rel_cellid, int resource_id, cAvidaContext& ctx) const;
   void AdjustSpatialResource(cAvidaContext& ctx, int rel_cellid, int resource_id, double amount);
   void AdjustResource(cAvidaContext& ctx, int resource_id, double amount);
@@ -273,8 +278,10 @@ public:
   double GetAndClearCellEnergy(int absolute_cell_id, cAvidaContext& ctx); 
   void GiveBackCellEnergy(int absolute_cell_id, double value, cAvidaContext& ctx); 
   void SetupDemeRes(int id, cResource * res, int verbosity, cWorld* world);                 
-  void UpdateDemeRes(cAvidaContext& ctx) { deme_resource_count.GetResources(ctx); } 
-  void Update(double time_step) { deme_resource_count.Update(time_step); }
+  void UpdateDemeRes(cAvidaContext& ctx) { SyncResourceTime(); deme_resource_count.GetResources(ctx); } 
+  //! Adds the resource time the population has counted since this deme's resources were last used.
+  void SyncResourceTime() const;
+  void ClearResourceSteps() { m_res_steps_applied = 0; }
   int GetRelativeCellID(int absolute_cell_id) const { return absolute_cell_id % GetSize(); } //!< assumes all demes are the same size
   int GetAbsoluteCellID(int relative_cell_id) const { return relative_cell_id + (_id * GetSize()); } //!< assumes all demes are the same size
 	
@@ -0,0 +1,71 @@
+/*
+ *  cEmptyCellIndex.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cEmptyCellIndex.h"
+
+#include <cassert>
+
+
+void cEmptyCellIndex::Resize(int num_cells, int deme_size)
+{
+  assert(deme_size > 0);
+  m_deme_size = deme_size;
+  m_empty.Resize(num_cells);
+  m_empty.SetAll();
+
+  m_world_order.ResizeClear(num_cells);
+  m_world_pos.ResizeClear(num_cells);
+  m_deme_order.ResizeClear(num_cells);
+  m_deme_pos.ResizeClear(num_cells);
+  for (int i = 0; i < num_cells; i++) {
+    m_world_order[i] = m_world_pos[i] = i;
+    m_deme_order[i] = m_deme_pos[i] = i;
+  }
+  m_world_empty = num_cells;
+
+  const int num_demes = (num_cells + deme_size - 1) / deme_size;
+  m_deme_empty.ResizeClear(num_demes);
+  for (int i = 0; i < num_demes; i++) m_deme_empty[i] = (i + 1 < num_demes) ? deme_size : num_cells - i * deme_size;
+}
+
+// Swaps cell_id with the cell at the boundary of its range, moving it into (empty) or out of the empty cells
+void cEmptyCellIndex::moveCell(Apto::Array<int>& order, Apto::Array<int>& pos, int start, int& num_empty, int cell_id,
+                               bool empty)
+{
+  const int from = pos[cell_id];
+  const int to = empty ? start + num_empty : start + num_empty - 1;
+  const int other_id = order[to];
+  order[to] = cell_id;
+  pos[cell_id] = to;
+  order[from] = other_id;
+  pos[other_id] = from;
+  num_empty += empty ? 1 : -1;
+}
+
+void cEmptyCellIndex::SetEmpty(int cell_id, bool empty)
+{
+  if (m_empty.Get(cell_id) == empty) return;
+  m_empty.Set(cell_id, empty);
+
+  moveCell(m_world_order, m_world_pos, 0, m_world_empty, cell_id, empty);
+  const int deme_id = cell_id / m_deme_size;
+  moveCell(m_deme_order, m_deme_pos, deme_id * m_deme_size, m_deme_empty[deme_id], cell_id, empty);
+}
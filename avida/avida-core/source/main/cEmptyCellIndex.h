@@ -0,0 +1,72 @@
+/*
+ *  cEmptyCellIndex.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cEmptyCellIndex_h
+#define cEmptyCellIndex_h
+
+#include "apto/core.h"
+#include "cBitArray.h"
+
+
+// The empty cells of the world, kept so that offspring placement never has to search for them.  An occupancy bitmap
+// answers whether a cell is empty from a dense array, which is what neighborhood scans read.  Two orderings of all
+// cells, one over the whole world and one with each deme in its own range, keep the empty cells at the front of each
+// range, so the number of empty cells and the i-th of them are known in constant time.  Filling or emptying a cell
+// swaps it across the boundary of its range.  Demes are the contiguous blocks of cells laid out by cPopulation.
+
+class cEmptyCellIndex
+{
+private:
+  int m_deme_size;
+  cBitArray m_empty;                    // set for each empty cell
+  Apto::Array<int> m_world_order;       // all cell ids, empty ones first
+  Apto::Array<int> m_world_pos;         // position of each cell in m_world_order
+  int m_world_empty;
+  Apto::Array<int> m_deme_order;        // cell ids of each deme in the deme's range, empty ones first
+  Apto::Array<int> m_deme_pos;          // position of each cell in m_deme_order
+  Apto::Array<int> m_deme_empty;        // empty cells in each deme
+
+  static void moveCell(Apto::Array<int>& order, Apto::Array<int>& pos, int start, int& num_empty, int cell_id, bool empty);
+
+  cEmptyCellIndex(const cEmptyCellIndex&); // @not_implemented
+  cEmptyCellIndex& operator=(const cEmptyCellIndex&); // @not_implemented
+
+public:
+  cEmptyCellIndex() : m_deme_size(0), m_world_empty(0) { ; }
+
+  // Every cell starts out empty
+  void Resize(int num_cells, int deme_size);
+
+  void SetEmpty(int cell_id, bool empty);
+  inline bool IsEmpty(int cell_id) const { return m_empty.Get(cell_id); }
+
+  inline int GetNumEmpty() const { return m_world_empty; }
+  inline int GetEmptyCell(int i) const { assert(i >= 0 && i < m_world_empty); return m_world_order[i]; }
+
+  inline int GetNumEmpty(int deme_id) const { return m_deme_empty[deme_id]; }
+  inline int GetEmptyCell(int deme_id, int i) const
+  {
+    assert(i >= 0 && i < m_deme_empty[deme_id]);
+    return m_deme_order[deme_id * m_deme_size + i];
+  }
+};
+
+#endif
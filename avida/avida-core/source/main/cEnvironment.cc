@@ -53,7 +53,8 @@ using namespace Avida;
 
 cEnvironment::cEnvironment(cWorld* world) : m_world(world) , m_tasklib(world),
 m_input_size(INPUT_SIZE_DEFAULT), m_output_size(OUTPUT_SIZE_DEFAULT), m_true_rand(false),
-m_use_specific_inputs(false), m_specific_inputs(), m_mask(0), m_hammers(false), m_paths(false)
+m_use_specific_inputs(false), m_specific_inputs(), m_mask(0), m_hammers(false), m_paths(false),
+m_logic_reaction_count(-1), m_reaction_values_mutable(false)
 {
   mut_rates.Setup(world);
   if (m_world->GetConfig().DEFAULT_GROUP.Get() != -1) possible_group_ids.insert(m_world->GetConfig().DEFAULT_GROUP.Get());
@@ -765,9 +766,11 @@ bool cEnvironment::LoadReaction(cString desc, Feedback& feedback)
   // Load in the reaction name
   const cString name = desc.PopWord();
   cReaction* new_reaction = reaction_lib.AddReaction(name);
+  SyncReactionValues();
 
   // If only a name was present, assume this reaction is a pre-declaration.
   if (desc.GetSize() == 0) {
+    BuildLogicDispatch();
     return true;
   }
 
@@ -825,9 +828,41 @@ bool cEnvironment::LoadReaction(cString desc, Feedback& feedback)
   if (envreqs.GetMinOutputs() > m_output_size) m_output_size = envreqs.GetMinOutputs();
   if (envreqs.GetTrueRandInputs()) m_true_rand = true;
 
+  SyncReactionValue(new_reaction);
+  BuildLogicDispatch();
   return true;
 }
 
+
+void cEnvironment::BuildLogicDispatch()
+{
+  const int num_reactions = reaction_lib.GetSize();
+  m_logic_reactions.ResizeClear(257);
+  for (int i = 0; i < m_logic_reactions.GetSize(); i++) m_logic_reactions[i].Resize(0);
+
+  for (int i = 0; i < num_reactions; i++) {
+    cReaction* cur_reaction = reaction_lib.GetReaction(i);
+    const cTaskEntry* cur_task = cur_reaction->GetTask();
+    
+    // Plasticity bonuses can mark a task that was not performed, so those reactions must always be tested
+    bool always_test = (cur_task == NULL || !cur_task->IsLogicOnly());
+    tLWConstListIterator<cReactionProcess> proc_it(cur_reaction->GetProcesses());
+    const cReactionProcess* cur_proc;
+    while (!always_test && (cur_proc = proc_it.Next()) != NULL) {
+      if (cur_proc->GetPhenPlastBonusMethod() != DEFAULT) always_test = true;
+    }
+    
+    if (always_test) {
+      for (int logic_id = 0; logic_id < m_logic_reactions.GetSize(); logic_id++) m_logic_reactions[logic_id].Push(i);
+    } else {
+      const Apto::Array<int>& logic_ids = cur_task->GetLogicIds();
+      for (int j = 0; j < logic_ids.GetSize(); j++) m_logic_reactions[logic_ids[j]].Push(i);
+    }
+  }
+  
+  m_logic_reaction_count = num_reactions;
+}
+
 bool cEnvironment::LoadGradientResource(cString desc, Feedback& feedback) 
 {
   if (desc.GetSize() == 0) {
@@ -1327,9 +1362,18 @@ bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
   // Do setup for reaction tests...
   m_tasklib.SetupTests(taskctx);
 
+  // Only the reactions that can trigger on this output's logic id need to be examined.  Context phenotypes update
+  // their counts for every reaction, so they still walk the full list.
+  const Apto::Array<int>* candidates = NULL;
+  if (context_phenotype == 0 && m_logic_reaction_count == reaction_lib.GetSize()) {
+    const int logic_id = taskctx.GetLogicId();
+    candidates = &m_logic_reactions[(logic_id >= 0 && logic_id < 256) ? logic_id : 256];
+  }
+
   // Loop through all reactions to see if any have been triggered...
-  const int num_reactions = reaction_lib.GetSize();
-  for (int i = 0; i < num_reactions; i++) {
+  const int num_reactions = (candidates) ? candidates->GetSize() : reaction_lib.GetSize();
+  for (int reaction_idx = 0; reaction_idx < num_reactions; reaction_idx++) {
+    const int i = (candidates) ? (*candidates)[reaction_idx] : reaction_idx;
     cReaction* cur_reaction = reaction_lib.GetReaction(i);
     assert(cur_reaction != NULL);
 
@@ -1867,15 +1911,27 @@ double cEnvironment::GetReactionValue(const cString& name)
   return found_reaction->GetValue();
 }
 
-double cEnvironment::GetReactionValue(int reaction_id)
+int cEnvironment::GetReactionID(const cString& name) const
 {
-  cReaction* found_reaction = reaction_lib.GetReaction(reaction_id);
-  if (found_reaction == NULL) return 0.0;
-  return found_reaction->GetValue();
+  cReaction* found_reaction = reaction_lib.GetReaction(name);
+  if (found_reaction == NULL) return -1;
+  return found_reaction->GetID();
+}
+
+void cEnvironment::SyncReactionValue(cReaction* reaction)
+{
+  m_reaction_values[reaction->GetID()] = reaction->GetValue();
+}
+
+void cEnvironment::SyncReactionValues()
+{
+  m_reaction_values.Resize(reaction_lib.GetSize());
+  for (int i = 0; i < reaction_lib.GetSize(); i++) SyncReactionValue(reaction_lib.GetReaction(i));
 }
 
 bool cEnvironment::SetReactionValue(cAvidaContext& ctx, const cString& name, double value)
 {
+  m_reaction_values_mutable = true;
   const int num_reactions = reaction_lib.GetSize();
 
   // See if this should be applied to all reactions.
@@ -1885,6 +1941,7 @@ bool cEnvironment::SetReactionValue(cAvidaContext& ctx, const cString& name, dou
       cReaction* cur_reaction = reaction_lib.GetReaction(i);
       assert(cur_reaction != NULL);
       cur_reaction->ModifyValue(value);
+      SyncReactionValue(cur_reaction);
     }
 
     return true;
@@ -1905,6 +1962,7 @@ bool cEnvironment::SetReactionValue(cAvidaContext& ctx, const cString& name, dou
       cReaction* cur_reaction = reaction_lib.GetReaction(reaction_ids[i]);
       assert(cur_reaction != NULL);
       cur_reaction->ModifyValue(value);
+      SyncReactionValue(cur_reaction);
     }
     return true;
   }
@@ -1912,14 +1970,17 @@ bool cEnvironment::SetReactionValue(cAvidaContext& ctx, const cString& name, dou
   cReaction* found_reaction = reaction_lib.GetReaction(name);
   if (found_reaction == NULL) return false;
   found_reaction->ModifyValue(value);
+  SyncReactionValue(found_reaction);
   return true;
 }
 
 bool cEnvironment::SetReactionValueMult(const cString& name, double value_mult)
 {
+  m_reaction_values_mutable = true;
   cReaction* found_reaction = reaction_lib.GetReaction(name);
   if (found_reaction == NULL) return false;
   found_reaction->MultiplyValue(value_mult);
+  SyncReactionValue(found_reaction);
   return true;
 }
 
@@ -1969,6 +2030,7 @@ bool cEnvironment::SetReactionTask(const cString& name, const cString& task)
     if (m_tasklib.GetTask(i).GetName() == task)
     {
       found_reaction->SetTask( m_tasklib.GetTaskReference(i) );
+      BuildLogicDispatch();
       return true;
     }
   }
@@ -83,6 +83,17 @@ private:
   bool m_hammers;
   bool m_paths;
   
+  // Reactions (in library order) that can trigger on an output with each logic id; the final entry is for outputs
+  // that are not a consistent logic function.  Only valid while m_logic_reaction_count matches the reaction library.
+  Apto::Array<Apto::Array<int> > m_logic_reactions;
+  int m_logic_reaction_count;
+  
+  // Current value of each reaction (its first process), indexed by reaction id, kept in step with the reactions
+  Apto::Array<double> m_reaction_values;
+  
+  // Set once anything may change reaction values during the run; until then speculative execution may read them
+  bool m_reaction_values_mutable;
+  
   cEnvironment(); // @not_implemented
   cEnvironment(const cEnvironment&); // @not_implemented
   cEnvironment& operator=(const cEnvironment&); // @not_implemented
@@ -136,9 +147,12 @@ public:
 
   const cString& GetReactionName(int reaction_id) const;
   double GetReactionValue(const cString& name);
-  double GetReactionValue(int reaction_id);
+  double GetReactionValue(int reaction_id) const { return m_reaction_values[reaction_id]; }
+  int GetReactionID(const cString& name) const;
   bool SetReactionValue(cAvidaContext& ctx, const cString& name, double value);
   bool SetReactionValueMult(const cString& name, double value_mult);
+  void DeclareReactionValueWriter() { m_reaction_values_mutable = true; }
+  bool ReactionValuesFixed() const { return !m_reaction_values_mutable; }
   bool SetReactionInst(const cString& name, cString inst_name);
   bool SetReactionMinTaskCount(const cString& name, int min_count);
   bool SetReactionMaxTaskCount(const cString& name, int max_count);
@@ -183,6 +197,9 @@ private:
   bool LoadSetActive(cString desc, Feedback& feedback);
   
   bool LoadGradientResource(cString desc, Feedback& feedback);
+  void BuildLogicDispatch();
+  void SyncReactionValues();
+  void SyncReactionValue(cReaction* reaction);
   double GetTaskProbability(cAvidaContext& ctx, cTaskContext& taskctx,
 
                             const tList<cReactionProcess>& req_proc, bool& force_mark_task) const;
@@ -373,6 +373,18 @@ void cEventList::QueueBirthInterruptEvent(double t_val)
 	}
 }
 
+// Check whether any event may process at the given update.
+bool cEventList::HasEventDue(double update) const
+{
+  for (cEventListEntry* entry = m_head; entry != NULL; entry = entry->GetNext()) {
+    if (entry->GetTrigger() != UPDATE) return true;
+    if ((update >= entry->GetStart() || entry->GetStart() == TRIGGER_BEGIN) &&
+        (update <= entry->GetStop() || entry->GetStop() == TRIGGER_END)) return true;
+  }
+  return false;
+}
+
+
 // Check to see whether or not a particular value is in the asynchronous
 // birth queue.
 bool cEventList::CheckBirthInterruptQueue(double)
@@ -113,6 +113,12 @@ public:
   
   void PrintEventList(std::ostream& os = std::cout);
   
+  /**
+   * Returns true if any event may be processed at the given update.  Events
+   * that are not triggered by update are always considered due.
+   **/
+  bool HasEventDue(double update) const;
+  
   /**
    * Returns true if a particular org_id (or Stats::tot_creature) value is present
    * in the interrupt queue.
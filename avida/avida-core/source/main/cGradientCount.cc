@@ -119,6 +119,9 @@ cGradientCount::cGradientCount(cWorld* world, int peakx, int peaky, int height,
   , m_min_usedy(-1)
   , m_max_usedx(-1)
   , m_max_usedy(-1)
+  , m_peak_dist_spread(-1)
+  , m_validate(world->GetConfig().GRADIENT_VALIDATE.Get())
+  , m_clear_pending(false)
 {
   ResetGradRes(m_world->GetDefaultContext(), worldx, worldy);
 }
@@ -127,7 +130,9 @@ cGradientCount::~cGradientCount() { ; }
 
 void cGradientCount::StateAll()
 {
-  return;
+  // Cell amounts are set directly by UpdateCount(); any flow deltas stay pending until the cell is next consumed
+  // from, so only the active spans are brought back in to the cells that hold something
+  TrimActiveSpans();
 }
 
 void cGradientCount::UpdateCount(cAvidaContext& ctx)
@@ -155,7 +160,7 @@ void cGradientCount::updatePeakRes(cAvidaContext& ctx)
     int min_pos_y = max(m_peaky - m_spread - 1, 0);
     for (int ii = min_pos_x; ii < max_pos_x + 1; ii++) {
       for (int jj = min_pos_y; jj < max_pos_y + 1; jj++) {
-        if (Element(jj * GetX() + ii).GetAmount() >= 1) {
+        if (GetAmount(jj * GetX() + ii) >= 1) {
           has_edible = true;
           break;
         }
@@ -267,6 +272,144 @@ void cGradientCount::generatePeak(cAvidaContext& ctx)
 }
 
 void cGradientCount::fillinResourceValues()
+{
+  if (!m_validate) {
+    fillinChangedValues();
+    return;
+  }
+  
+  // Validation: run the full recompute, rewind to the starting state, run the incremental update, and compare
+  const int num_cells = GetSize();
+  Apto::Array<double> start_amounts(num_cells);
+  for (int i = 0; i < num_cells; i++) start_amounts[i] = GetAmount(i);
+  const Apto::Array<double> start_plateau = m_plateau_array;
+  const Apto::Array<int> start_plateau_ids = m_plateau_cell_IDs;
+  const double start_current_height = m_current_height;
+  const double start_common_height = m_common_plat_height;
+  const double start_past_height = m_past_height;
+  const bool start_just_reset = m_just_reset;
+  
+  fillinAllValues();
+  
+  Apto::Array<double> full_amounts(num_cells);
+  for (int i = 0; i < num_cells; i++) full_amounts[i] = GetAmount(i);
+  const Apto::Array<double> full_plateau = m_plateau_array;
+  const Apto::Array<int> full_plateau_ids = m_plateau_cell_IDs;
+  const double full_current_height = m_current_height;
+  const double full_past_height = m_past_height;
+  const int full_bounds[4] = { m_min_usedx, m_min_usedy, m_max_usedx, m_max_usedy };
+  
+  for (int i = 0; i < num_cells; i++) if (GetAmount(i) != start_amounts[i]) SetCellAmount(i, start_amounts[i]);
+  m_plateau_array = start_plateau;
+  m_plateau_cell_IDs = start_plateau_ids;
+  m_current_height = start_current_height;
+  m_common_plat_height = start_common_height;
+  m_past_height = start_past_height;
+  m_just_reset = start_just_reset;
+  
+  fillinChangedValues();
+  
+  int bad_cell = -1;
+  for (int i = 0; i < num_cells && bad_cell == -1; i++) if (GetAmount(i) != full_amounts[i]) bad_cell = i;
+  bool matches = (bad_cell == -1 && m_current_height == full_current_height && m_past_height == full_past_height);
+  matches = matches && m_min_usedx == full_bounds[0] && m_min_usedy == full_bounds[1];
+  matches = matches && m_max_usedx == full_bounds[2] && m_max_usedy == full_bounds[3];
+  for (int i = 0; i < m_plateau_array.GetSize() && matches; i++) {
+    matches = (m_plateau_array[i] == full_plateau[i] && m_plateau_cell_IDs[i] == full_plateau_ids[i]);
+  }
+  if (!matches) {
+    m_world->GetDriver().Feedback().Error("Incremental gradient resource update differs from full recompute at update %d (cell %d)",
+                                          m_world->GetStats().GetUpdate(), bad_cell);
+  }
+}
+
+void cGradientCount::fillinChangedValues()
+{
+  // Gives the same result as fillinAllValues(), cell for cell, but only touches the cells within the spread of the
+  // peak and the cells that still hold something to clear, and distances come from a table rather than a square
+  // root per cell.
+  resetUsedBounds();
+  updateCurrentHeight();
+  if (m_peak_dist_spread != m_spread) buildPeakDistances();
+  
+  const int world_x = GetX();
+  const int world_y = GetY();
+  int max_pos_x;
+  int min_pos_x;
+  int max_pos_y;
+  int min_pos_y;
+  
+  if (m_just_reset) {
+    // a reset clears the whole world outside the spread
+    max_pos_x = world_x - 1;
+    min_pos_x = 0;
+    max_pos_y = world_y - 1;
+    min_pos_y = 0;
+  } else {
+    // otherwise only the possible range of the peak, back to move_speed so that no old residue is left behind
+    max_pos_x = min(m_peakx + m_spread + m_move_speed + 1, world_x - 1);
+    min_pos_x = max(m_peakx - m_spread - m_move_speed - 1, 0);
+    max_pos_y = min(m_peaky + m_spread + m_move_speed + 1, world_y - 1);
+    min_pos_y = max(m_peaky - m_spread - m_move_speed - 1, 0);
+  }
+  
+  // Compute the cells within the spread, a column at a time in the same order as the full pass.  Cone cells read
+  // back the old footprint; the clearing beyond the spread is left until afterwards, with pastAmount() standing in
+  // for the cells the full pass would already have cleared.
+  m_clear_pending = true;
+  m_clear_min_x = min_pos_x;
+  m_clear_max_x = max_pos_x;
+  m_clear_min_y = min_pos_y;
+  m_clear_max_y = max_pos_y;
+  
+  int plateau_cell = 0;
+  if (m_spread >= 0) {
+    const int width = 2 * m_spread + 1;
+    for (int ii = max(m_peakx - m_spread, min_pos_x); ii <= min(m_peakx + m_spread, max_pos_x); ii++) {
+      const int dx = m_peakx - ii;
+      const int half_height = m_peak_half_width[dx + m_spread];
+      for (int jj = max(m_peaky - half_height, min_pos_y); jj <= min(m_peaky + half_height, max_pos_y); jj++) {
+        const double thisdist = m_peak_dist[(dx + m_spread) * width + m_peaky - jj + m_spread];
+        const double thisheight = calcCellHeight(ii, jj, thisdist, plateau_cell);
+        SetCellAmount(jj * world_x + ii, thisheight);
+        if (thisheight > 0) updateBounds(ii, jj);
+      }
+    }
+  }
+  m_clear_pending = false;
+  
+  // Clear the rest of the range, only looking at the part of each row that may hold something
+  for (int jj = min_pos_y; jj <= max_pos_y; jj++) {
+    const int dy = m_peaky - jj;
+    if (dy < -m_spread || dy > m_spread) {
+      ClearRowRange(jj, min_pos_x, max_pos_x);
+    } else {
+      const int half_width = m_peak_half_width[dy + m_spread];
+      ClearRowRange(jj, min_pos_x, m_peakx - half_width - 1);
+      ClearRowRange(jj, m_peakx + half_width + 1, max_pos_x);
+    }
+  }
+  
+  SetCurrPeakX(m_peakx);
+  SetCurrPeakY(m_peaky);
+  m_just_reset = false;
+}
+
+double cGradientCount::pastAmount(int old_x, int old_y, int ii, int jj) const
+{
+  // While fillinChangedValues() defers its clearing, a cell that fillinAllValues() would already have cleared by the
+  // time it reached (ii, jj) -- one earlier in column order, in range and beyond the spread -- reads as zero
+  if (m_clear_pending && (old_x < ii || (old_x == ii && old_y < jj))) {
+    double dist = 0.0;
+    if (old_x >= m_clear_min_x && old_x <= m_clear_max_x && old_y >= m_clear_min_y && old_y <= m_clear_max_y &&
+        !withinSpread(m_peakx - old_x, m_peaky - old_y, dist)) {
+      return 0.0;
+    }
+  }
+  return GetAmount(old_y * GetX() + old_x);
+}
+
+void cGradientCount::fillinAllValues()
 {  
   int max_pos_x;
   int min_pos_x;
@@ -297,6 +440,25 @@ void cGradientCount::fillinResourceValues()
     min_pos_y = max(m_peaky - m_spread - m_move_speed - 1, 0);
   }
 
+  updateCurrentHeight();
+
+  int plateau_cell = 0;
+  for (int ii = min_pos_x; ii < max_pos_x + 1; ii++) {
+    for (int jj = min_pos_y; jj < max_pos_y + 1; jj++) {
+      double thisheight = 0.0;
+      double thisdist = sqrt((double) (m_peakx - ii) * (m_peakx - ii) + (m_peaky - jj) * (m_peaky - jj));
+      if (m_spread >= thisdist) thisheight = calcCellHeight(ii, jj, thisdist, plateau_cell);
+      SetCellAmount(jj * GetX() + ii, thisheight);
+      if (thisheight > 0) updateBounds(ii, jj);
+    }
+  }         
+  SetCurrPeakX(m_peakx);
+  SetCurrPeakY(m_peaky);
+  m_just_reset = false;
+}
+
+void cGradientCount::updateCurrentHeight()
+{
   if (m_is_plateau_common == 1 && !m_just_reset && m_world->GetStats().GetUpdate() > 0) {
     // with common depletion, new peak height is not the plateau heights, but the delta in plateau heights applied to 
     // peak height from the last time
@@ -310,92 +472,103 @@ void cGradientCount::fillinResourceValues()
   else {
     m_current_height = m_height;
   }
+}
 
-  int plateau_cell = 0;
-  for (int ii = min_pos_x; ii < max_pos_x + 1; ii++) {
-    for (int jj = min_pos_y; jj < max_pos_y + 1; jj++) {
-      double thisheight = 0.0;
-      double thisdist = sqrt((double) (m_peakx - ii) * (m_peakx - ii) + (m_peaky - jj) * (m_peaky - jj));
-      if (m_spread >= thisdist) {
-        // determine theoretical individual cells values and add one to distance from center 
-        // (so that center point = radius 1, not 0)
-        // also used to distinguish plateau cells
-        
-        thisheight = m_current_height / (thisdist + 1);
-        
-        // set the floor values
-        // plateaus will override this so that plateaus can hit 0 when being eaten
-        if (thisheight < m_floor) thisheight = m_floor;
-        
-        // create cylindrical profiles of resources whereever thisheight would be >1 (area where thisdist + 1 <= m_height)
-        // and slopes outside of that range
-        // plateau = -1 turns off this option; if activated, causes 'peaks' to be flat plateaus = plateau value 
-        bool is_plat_cell = ((m_height / (thisdist + 1)) >= 1);
-        // apply plateau inflow(s) and outflow 
-        if ((is_plat_cell && m_plateau >= 0) || (m_plateau < 0 && thisdist == 0 && m_plateau_array.GetSize())) { 
-          if (m_just_reset || m_world->GetStats().GetUpdate() <= 0) {
-            m_past_height = m_height;
-            if (m_plateau >= 0.0) {
-              thisheight = m_plateau;
-            } 
-            else {
-              thisheight = m_height;
-            }
-          } 
-          else { 
-            if (m_is_plateau_common == 0) {
-              m_past_height = m_plateau_array[plateau_cell]; 
-              thisheight = m_past_height + m_plateau_inflow - (m_past_height * m_plateau_outflow);
-              thisheight += m_gradient_inflow / (thisdist + 1);
-              if (thisheight > m_plateau && m_plateau >= 0) {
-                thisheight = m_plateau;
-              } 
-              if (m_plateau < 0 && thisdist == 0 && thisheight > m_height) {
-                thisheight = m_height;
-              }
-            }
-            else if (m_is_plateau_common == 1) {   
-              thisheight = m_common_plat_height;
-            }
-          }
-          if (m_initial && m_initial_plat != -1) thisheight = m_initial_plat;
-          if (thisheight < 0) thisheight = 0;
-          m_plateau_array[plateau_cell] = thisheight;
-          m_plateau_cell_IDs[plateau_cell] = jj * GetX() + ii;
-          plateau_cell ++;
-         }
-        // now apply any off-plateau inflow(s) and outflow
-        else if (!is_plat_cell && (m_cone_inflow > 0 || m_cone_outflow > 0 || m_gradient_inflow > 0)) {
-          if (!m_just_reset && m_world->GetStats().GetUpdate() > 0) {
-            int offsetx = m_old_peakx - m_peakx;
-            int offsety = m_old_peaky - m_peaky;
-            
-            int old_cell_x = ii + offsetx;
-            int old_cell_y = jj + offsety;
-            
-            // cone cells that were previously off the world and moved onto world, start at 0
-            if ( old_cell_x < 0 || old_cell_y < 0 || (old_cell_y > (GetY() - 1)) || (old_cell_x > (GetX() - 1)) ) {
-              thisheight = 0;
-            }
-            else {
-              double past_height = Element(old_cell_y * GetX() + old_cell_x).GetAmount(); 
-              double newheight = past_height; 
-              if (m_cone_inflow > 0 || m_cone_outflow > 0) newheight += m_cone_inflow - (past_height * m_cone_outflow);
-              if (m_gradient_inflow > 0) newheight += m_gradient_inflow / (thisdist + 1); 
-              // don't exceed expected slope value
-              if (newheight < thisheight) thisheight = newheight;
-              if (thisheight < 0) thisheight = 0;
-            }
-          }
+double cGradientCount::calcCellHeight(int ii, int jj, double thisdist, int& plateau_cell)
+{
+  // determine theoretical individual cells values and add one to distance from center 
+  // (so that center point = radius 1, not 0)
+  // also used to distinguish plateau cells
+  
+  double thisheight = m_current_height / (thisdist + 1);
+  
+  // set the floor values
+  // plateaus will override this so that plateaus can hit 0 when being eaten
+  if (thisheight < m_floor) thisheight = m_floor;
+  
+  // create cylindrical profiles of resources whereever thisheight would be >1 (area where thisdist + 1 <= m_height)
+  // and slopes outside of that range
+  // plateau = -1 turns off this option; if activated, causes 'peaks' to be flat plateaus = plateau value 
+  bool is_plat_cell = ((m_height / (thisdist + 1)) >= 1);
+  // apply plateau inflow(s) and outflow 
+  if ((is_plat_cell && m_plateau >= 0) || (m_plateau < 0 && thisdist == 0 && m_plateau_array.GetSize())) { 
+    if (m_just_reset || m_world->GetStats().GetUpdate() <= 0) {
+      m_past_height = m_height;
+      if (m_plateau >= 0.0) {
+        thisheight = m_plateau;
+      } 
+      else {
+        thisheight = m_height;
+      }
+    } 
+    else { 
+      if (m_is_plateau_common == 0) {
+        m_past_height = m_plateau_array[plateau_cell]; 
+        thisheight = m_past_height + m_plateau_inflow - (m_past_height * m_plateau_outflow);
+        thisheight += m_gradient_inflow / (thisdist + 1);
+        if (thisheight > m_plateau && m_plateau >= 0) {
+          thisheight = m_plateau;
+        } 
+        if (m_plateau < 0 && thisdist == 0 && thisheight > m_height) {
+          thisheight = m_height;
         }
       }
-      Element(jj * GetX() + ii).SetAmount(thisheight);
-      if (thisheight > 0) updateBounds(ii, jj);
+      else if (m_is_plateau_common == 1) {   
+        thisheight = m_common_plat_height;
+      }
     }
-  }         
-  SetCurrPeakX(m_peakx);
-  SetCurrPeakY(m_peaky);
-  m_just_reset = false;
+    if (m_initial && m_initial_plat != -1) thisheight = m_initial_plat;
+    if (thisheight < 0) thisheight = 0;
+    m_plateau_array[plateau_cell] = thisheight;
+    m_plateau_cell_IDs[plateau_cell] = jj * GetX() + ii;
+    plateau_cell ++;
+  }
+  // now apply any off-plateau inflow(s) and outflow
+  else if (!is_plat_cell && (m_cone_inflow > 0 || m_cone_outflow > 0 || m_gradient_inflow > 0)) {
+    if (!m_just_reset && m_world->GetStats().GetUpdate() > 0) {
+      int offsetx = m_old_peakx - m_peakx;
+      int offsety = m_old_peaky - m_peaky;
+      
+      int old_cell_x = ii + offsetx;
+      int old_cell_y = jj + offsety;
+      
+      // cone cells that were previously off the world and moved onto world, start at 0
+      if ( old_cell_x < 0 || old_cell_y < 0 || (old_cell_y > (GetY() - 1)) || (old_cell_x > (GetX() - 1)) ) {
+        thisheight = 0;
+      }
+      else {
+        double past_height = pastAmount(old_cell_x, old_cell_y, ii, jj);
+        double newheight = past_height; 
+        if (m_cone_inflow > 0 || m_cone_outflow > 0) newheight += m_cone_inflow - (past_height * m_cone_outflow);
+        if (m_gradient_inflow > 0) newheight += m_gradient_inflow / (thisdist + 1); 
+        // don't exceed expected slope value
+        if (newheight < thisheight) thisheight = newheight;
+        if (thisheight < 0) thisheight = 0;
+      }
+    }
+  }
+  return thisheight;
+}
+
+void cGradientCount::buildPeakDistances()
+{
+  m_peak_dist_spread = m_spread;
+  if (m_spread < 0) {
+    m_peak_dist.Resize(0);
+    m_peak_half_width.Resize(0);
+    return;
+  }
+  const int width = 2 * m_spread + 1;
+  m_peak_dist.Resize(width * width);
+  m_peak_half_width.Resize(width);
+  m_peak_half_width.SetAll(0);
+  for (int dx = -m_spread; dx <= m_spread; dx++) {
+    for (int dy = -m_spread; dy <= m_spread; dy++) {
+      const double thisdist = sqrt((double) dx * dx + dy * dy);
+      m_peak_dist[(dx + m_spread) * width + dy + m_spread] = thisdist;
+      if (m_spread >= thisdist && dx > m_peak_half_width[dy + m_spread]) m_peak_half_width[dy + m_spread] = dx;
+    }
+  }
 }
 
 void cGradientCount::getCurrentPlatValues()
@@ -415,7 +588,7 @@ void cGradientCount::getCurrentPlatValues()
       double find_plat_dist = temp_height / (thisdist + 1);
       if ((find_plat_dist >= 1 && m_plateau >= 0) || (m_plateau < 0 && thisdist == 0 && m_plateau_array.GetSize() > 0)) {
         double past_cell_height = m_plateau_array[plateau_cell];
-        double pre_move_height = Element(m_plateau_cell_IDs[plateau_cell]).GetAmount();  
+        double pre_move_height = GetAmount(m_plateau_cell_IDs[plateau_cell]);  
         if (pre_move_height < past_cell_height) {
           m_plateau_array[plateau_cell] = pre_move_height; 
           amount_devoured = amount_devoured + past_cell_height - pre_move_height;
@@ -661,13 +834,13 @@ void cGradientCount::generateBarrier(cAvidaContext& ctx)
     // clear any old resource
     if (m_wall_cells.GetSize()) {
       for (int i = 0; i < m_wall_cells.GetSize(); i++) {
-        Element(m_wall_cells[i]).SetAmount(0);
+        SetCellAmount(m_wall_cells[i], 0);
       }
     }
     else {
       for (int ii = 0; ii < GetX(); ii++) {
         for (int jj = 0; jj < GetY(); jj++) {
-          Element(jj * GetX() + ii).SetAmount(0);
+          SetCellAmount(jj * GetX() + ii, 0);
         }
       }
     }
@@ -685,7 +858,7 @@ void cGradientCount::generateBarrier(cAvidaContext& ctx)
         start_randx = ctx.GetRandom().GetUInt(0, GetX());
         start_randy = ctx.GetRandom().GetUInt(0, GetY());  
       }
-      Element(start_randy * GetX() + start_randx).SetAmount(m_plateau);
+      SetCellAmount(start_randy * GetX() + start_randx, m_plateau);
       // if (m_plateau > 0) updateBounds(start_randx, start_randy);
       updateBounds(start_randx, start_randy);
       m_wall_cells.Push(start_randy * GetX() + start_randx);
@@ -779,12 +952,12 @@ void cGradientCount::generateBarrier(cAvidaContext& ctx)
                randy < (m_halo_anchor_y + m_halo_inner_radius) && 
                randx > (m_halo_anchor_x - m_halo_inner_radius) && 
                randy > (m_halo_anchor_y - m_halo_inner_radius)) || 
-              (m_config == 0 && Element(randy * GetX() + randx).GetAmount())) {
+              (m_config == 0 && GetAmount(randy * GetX() + randx))) {
             num_blocks --;
             count_block = false;
           }
           if (count_block) {
-            Element(randy * GetX() + randx).SetAmount(m_plateau);
+            SetCellAmount(randy * GetX() + randx, m_plateau);
             if (m_plateau > 0) updateBounds(randx, randy);
             m_wall_cells.Push(randy * GetX() + randx);
             if (place_corner) {
@@ -793,7 +966,7 @@ void cGradientCount::generateBarrier(cAvidaContext& ctx)
                      cornery < (m_halo_anchor_y + m_halo_inner_radius) && 
                      cornerx > (m_halo_anchor_x - m_halo_inner_radius) && 
                      cornery > (m_halo_anchor_y - m_halo_inner_radius))) ){
-                  Element(cornery * GetX() + cornerx).SetAmount(m_plateau);
+                  SetCellAmount(cornery * GetX() + cornerx, m_plateau);
                   if (m_plateau > 0) updateBounds(cornerx, cornery);
                   m_wall_cells.Push(randy * GetX() + randx);
                 }
@@ -832,14 +1005,14 @@ void cGradientCount::generateHills(cAvidaContext& ctx)
     if (m_min_usedx == -1 || m_min_usedy == -1 || m_max_usedx == -1 || m_max_usedy == -1) {
       for (int ii = 0; ii < GetX(); ii++) {
         for (int jj = 0; jj < GetY(); jj++) {
-          Element(jj * GetX() + ii).SetAmount(0);
+          SetCellAmount(jj * GetX() + ii, 0);
         }
       }
     }
     else {
       for (int ii = m_min_usedx; ii < m_max_usedx + 1; ii++) {
         for (int jj = m_min_usedy; jj < m_max_usedy + 1; jj++) {
-          Element(jj * GetX() + ii).SetAmount(0);
+          SetCellAmount(jj * GetX() + ii, 0);
         }
       }
     }
@@ -879,9 +1052,9 @@ void cGradientCount::generateHills(cAvidaContext& ctx)
           double thisheight = 0.0;
           double thisdist = sqrt((double) (m_peakx - ii) * (m_peakx - ii) + (m_peaky - jj) * (m_peaky - jj));
           // only plot values when within set config radius & if no larger amount has already been plotted for another overlapping hill
-          if ((thisdist <= rand_hill_radius) && (Element(jj * GetX() + ii).GetAmount() <  m_plateau / (thisdist + 1))) {
+          if ((thisdist <= rand_hill_radius) && (GetAmount(jj * GetX() + ii) <  m_plateau / (thisdist + 1))) {
           thisheight = m_plateau / (thisdist + 1);
-          Element(jj * GetX() + ii).SetAmount(thisheight);
+          SetCellAmount(jj * GetX() + ii, thisheight);
           if (thisheight > 0) updateBounds(ii, jj);
           }
         }
@@ -970,7 +1143,7 @@ void cGradientCount::UpdatePredatoryRes(cAvidaContext& ctx)
   // kill off up to 1 org per update within the predator radius (plateau area), with prob of death for selected prey = m_pred_odds
   if (m_predator) {
     for (int i = 0; i < m_plateau_cell_IDs.GetSize(); i ++) {
-      if (Element(m_plateau_cell_IDs[i]).GetAmount() >= 1) {
+      if (GetAmount(m_plateau_cell_IDs[i]) >= 1) {
         m_world->GetPopulation().ExecutePredatoryResource(ctx, m_plateau_cell_IDs[i], m_pred_odds, m_guarded_juvs_per_adult, m_hammer);
       }
     }
@@ -989,7 +1162,7 @@ void cGradientCount::UpdateDamagingRes(cAvidaContext& ctx)
   // we don't call this for walls and hills because they never move
   if (m_damage) {
     for (int i = 0; i < m_plateau_cell_IDs.GetSize(); i ++) {
-      if (Element(m_plateau_cell_IDs[i]).GetAmount() >= m_threshold) {
+      if (GetAmount(m_plateau_cell_IDs[i]) >= m_threshold) {
         // skip if initiating world and resources (cells don't exist yet)
         if (ctx.HasDriver()) m_world->GetPopulation().ExecuteDamagingResource(ctx, m_plateau_cell_IDs[i], m_damage, m_hammer);
       }
@@ -1002,7 +1175,7 @@ void cGradientCount::UpdateDeadlyRes(cAvidaContext& ctx)
   // we don't call this for walls and hills because they never move
   if (m_deadly) {
     for (int i = 0; i < m_plateau_cell_IDs.GetSize(); i ++) {
-      if (Element(m_plateau_cell_IDs[i]).GetAmount() >= m_threshold) {
+      if (GetAmount(m_plateau_cell_IDs[i]) >= m_threshold) {
         // skip if initiating world and resources (cells don't exist yet)
         if (ctx.HasDriver()) m_world->GetPopulation().ExecuteDeadlyResource(ctx, m_plateau_cell_IDs[i], m_death_odds, m_hammer);
       }
@@ -1044,7 +1217,7 @@ void cGradientCount::BuildProbabilisticRes(cAvidaContext& ctx, double lambda, do
 
   // only if theta == 1 do want want a 'hill' with resource for certain in the center
   if (theta == 0) {
-    Element(m_peaky * worldx + m_peakx).SetAmount(m_initial_plat);
+    SetCellAmount(m_peaky * worldx + m_peakx, m_initial_plat);
     if (m_initial_plat > 0) updateBounds(m_peakx, m_peaky);
     if (m_plateau_outflow > 0 || m_plateau_inflow > 0) { 
       if (num_cells == -1) m_prob_res_cells.Push(m_peaky * worldx + m_peakx);
@@ -1079,7 +1252,7 @@ void cGradientCount::BuildProbabilisticRes(cAvidaContext& ctx, double lambda, do
     double this_prob = (1/lambda) * (sqrt(2 / 3.14159)) * exp(-0.5 * pow(((cell_dist - theta) / lambda), 2));
     
     if (ctx.GetRandom().P(this_prob)) {
-      Element(cell_id).SetAmount(m_initial_plat);
+      SetCellAmount(cell_id, m_initial_plat);
       if (m_initial_plat > 0) updateBounds(this_x, this_y);
       if (m_plateau_outflow > 0 || m_plateau_inflow > 0) {
         if (loop_once) m_prob_res_cells.Push(cell_id);
@@ -1090,7 +1263,7 @@ void cGradientCount::BuildProbabilisticRes(cAvidaContext& ctx, double lambda, do
     }
     // just push this cell out of the way for this loop, but keep it around for next time
     else { 
-      Element(cell_id).SetAmount(0); 
+      SetCellAmount(cell_id, 0); 
       cell_id_array.Swap(cell_idx, max_unused_idx--);
     }
 
@@ -1106,9 +1279,9 @@ void cGradientCount::UpdateProbabilisticRes()
 {
   if (m_plateau_outflow > 0 || m_plateau_inflow > 0) {
     for (int i = 0; i < m_prob_res_cells.GetSize(); i++) {
-      double curr_val = Element(m_prob_res_cells[i]).GetAmount();
+      double curr_val = GetAmount(m_prob_res_cells[i]);
       double amount = curr_val + m_plateau_inflow - (curr_val * m_plateau_outflow);
-      Element(m_prob_res_cells[i]).SetAmount(amount); 
+      SetCellAmount(m_prob_res_cells[i], amount); 
       if (amount > 0) updateBounds(m_prob_res_cells[i] % GetX(), m_prob_res_cells[i] / GetX());
     }
   }
@@ -1118,7 +1291,7 @@ void cGradientCount::clearExistingProbRes()
 {
   for (int x = m_min_usedx; x < m_max_usedx + 1; x ++) {
     for (int y = m_min_usedy; y < m_max_usedy + 1; y ++) {
-      Element(y * GetX() + x).SetAmount(0);
+      SetCellAmount(y * GetX() + x, 0);
     }
   }
 }
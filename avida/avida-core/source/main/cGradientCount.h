@@ -116,6 +116,20 @@ private:
   int m_min_usedy;
   int m_max_usedx;
   int m_max_usedy;
+  
+  // Distance from the peak for each offset within the spread, indexed [(dx + spread) * (2 * spread + 1) + dy + spread],
+  // and for each dy the largest |dx| still within the spread, indexed [dy + spread]
+  Apto::Array<double> m_peak_dist;
+  Apto::Array<int> m_peak_half_width;
+  int m_peak_dist_spread;
+  bool m_validate;
+  
+  // While fillinChangedValues() is computing the cells within the spread, the range it will clear afterwards
+  bool m_clear_pending;
+  int m_clear_min_x;
+  int m_clear_max_x;
+  int m_clear_min_y;
+  int m_clear_max_y;
     
 public:
   cGradientCount(cWorld* world, int peakx, int peaky, int height, int spread, double plateau, int decay,              
@@ -128,6 +142,7 @@ public:
   ~cGradientCount();
 
   void UpdateCount(cAvidaContext& ctx);
+  bool RequiresSerialUpdate() const { return true; }
   void StateAll();
   
   void SetGradInitialPlat(double plat_val) { m_initial_plat = plat_val; m_initial = true; }
@@ -187,6 +202,13 @@ public:
   
 private:
   void fillinResourceValues();
+  void fillinChangedValues();
+  void fillinAllValues();
+  void updateCurrentHeight();
+  double calcCellHeight(int ii, int jj, double thisdist, int& plateau_cell);
+  void buildPeakDistances();
+  inline bool withinSpread(int dx, int dy, double& thisdist) const;
+  double pastAmount(int old_x, int old_y, int ii, int jj) const;
   void updatePeakRes(cAvidaContext& ctx);
   void moveRes(cAvidaContext& ctx);
   int setHaloOrbit(cAvidaContext& ctx, int current_orbit);
@@ -205,4 +227,12 @@ private:
   inline void setHaloDirection(cAvidaContext& ctx);
 };
 
+
+inline bool cGradientCount::withinSpread(int dx, int dy, double& thisdist) const
+{
+  if (dx < -m_spread || dx > m_spread || dy < -m_spread || dy > m_spread) return false;
+  thisdist = m_peak_dist[(dx + m_spread) * (2 * m_spread + 1) + dy + m_spread];
+  return (m_spread >= thisdist);
+}
+
 #endif
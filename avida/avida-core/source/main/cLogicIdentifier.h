@@ -0,0 +1,132 @@
+/*
+ *  cLogicIdentifier.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cLogicIdentifier_h
+#define cLogicIdentifier_h
+
+// Identifies which logic function of (up to) three inputs an output computes, returning its logic id:
+//
+//  Logic ID Bit: 7 6 5 4 3 2 1 0
+//       Input C: 1 1 1 1 0 0 0 0
+//       Input B: 1 1 0 0 1 1 0 0
+//       Input A: 1 0 1 0 1 0 1 0
+//
+// or -1 if the output is not consistent with any one function.  All 32 bit positions are tested at once: for each
+// input combination a mask holds the bit positions where the inputs take that combination, and the output must be
+// all ones or all zeros under it.  The masks depend only on the inputs, so they are kept between calls until the
+// inputs change, as is the result for the most recent output.
+
+class cLogicIdentifier
+{
+private:
+  int m_inputs[3];
+  int m_num_inputs;
+  unsigned int m_combo_mask[8];
+  
+  bool m_has_last;
+  int m_last_output;
+  int m_last_logic_id;
+  
+public:
+  cLogicIdentifier() : m_num_inputs(-1), m_has_last(false), m_last_output(0), m_last_logic_id(-1)
+  {
+    for (int i = 0; i < 3; i++) m_inputs[i] = 0;
+  }
+  
+  // Only the first three inputs are used; missing inputs are treated as zero
+  inline void SetInputs(const int* inputs, int num_inputs);
+  inline int GetLogicId(int output);
+  
+  static int ComputeLogicId(const int* inputs, int num_inputs, int output)
+  {
+    cLogicIdentifier ident;
+    ident.SetInputs(inputs, num_inputs);
+    return ident.GetLogicId(output);
+  }
+};
+
+
+inline void cLogicIdentifier::SetInputs(const int* inputs, int num_inputs)
+{
+  if (num_inputs > 3) num_inputs = 3;
+  int test_inputs[3];
+  for (int i = 0; i < 3; i++) test_inputs[i] = (num_inputs > i) ? inputs[i] : 0;
+  
+  if (num_inputs == m_num_inputs && test_inputs[0] == m_inputs[0] && test_inputs[1] == m_inputs[1] &&
+      test_inputs[2] == m_inputs[2]) {
+    return;
+  }
+  
+  m_num_inputs = num_inputs;
+  for (int i = 0; i < 3; i++) m_inputs[i] = test_inputs[i];
+  m_has_last = false;
+  
+  const unsigned int a = static_cast<unsigned int>(test_inputs[0]);
+  const unsigned int b = static_cast<unsigned int>(test_inputs[1]);
+  const unsigned int c = static_cast<unsigned int>(test_inputs[2]);
+  for (int combo = 0; combo < 8; combo++) {
+    m_combo_mask[combo] = ((combo & 1) ? a : ~a) & ((combo & 2) ? b : ~b) & ((combo & 4) ? c : ~c);
+  }
+}
+
+inline int cLogicIdentifier::GetLogicId(int output)
+{
+  if (m_has_last && output == m_last_output) return m_last_logic_id;
+  
+  // Build the truth table as two bit sets: combinations that output 1, and combinations that never occur in the
+  // inputs (which count as -1 in the logic id sum)
+  const unsigned int out = static_cast<unsigned int>(output);
+  int ones = 0;
+  int missing = 0;
+  bool consistent = true;
+  for (int combo = 0; combo < 8; combo++) {
+    const unsigned int mask = m_combo_mask[combo];
+    const unsigned int hits = out & mask;
+    consistent &= (hits == 0 || hits == mask);
+    ones |= (hits != 0) << combo;
+    missing |= (mask == 0) << combo;
+  }
+  
+  int logic_id = -1;
+  if (consistent) {
+    // Combinations involving inputs that were never given take the value of the same combination without them
+    if (m_num_inputs < 1) {
+      ones = (ones & ~0x02) | ((ones & 0x01) << 1);
+      missing = (missing & ~0x02) | ((missing & 0x01) << 1);
+    }
+    if (m_num_inputs < 2) {
+      ones = (ones & ~0x0c) | ((ones & 0x03) << 2);
+      missing = (missing & ~0x0c) | ((missing & 0x03) << 2);
+    }
+    if (m_num_inputs < 3) {
+      ones = (ones & 0x0f) | ((ones & 0x0f) << 4);
+      missing = (missing & 0x0f) | ((missing & 0x0f) << 4);
+    }
+    logic_id = ones - missing;
+  }
+  
+  m_has_last = true;
+  m_last_output = output;
+  m_last_logic_id = logic_id;
+  return logic_id;
+}
+
+#endif
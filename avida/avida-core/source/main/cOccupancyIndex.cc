@@ -0,0 +1,131 @@
+/*
+ *  cOccupancyIndex.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cOccupancyIndex.h"
+
+#include <cassert>
+
+
+void cOccupancyIndex::Resize(int world_x, int world_y)
+{
+  m_world_x = world_x;
+  m_world_y = world_y;
+  for (int k = 0; k < NUM_KINDS; k++) {
+    m_tree[k].ResizeClear((world_x + 1) * (world_y + 1));
+    m_tree[k].SetAll(0);
+  }
+  m_cell_counts.ResizeClear(world_x * world_y * NUM_KINDS);
+  m_cell_counts.SetAll(0);
+}
+
+void cOccupancyIndex::add(int kind, int x, int y, int delta)
+{
+  Apto::Array<int>& tree = m_tree[kind];
+  const int stride = m_world_x + 1;
+  for (int i = x + 1; i <= m_world_x; i += (i & -i)) {
+    for (int j = y + 1; j <= m_world_y; j += (j & -j)) tree[j * stride + i] += delta;
+  }
+}
+
+int cOccupancyIndex::prefix(int kind, int x, int y) const
+{
+  const Apto::Array<int>& tree = m_tree[kind];
+  const int stride = m_world_x + 1;
+  int sum = 0;
+  for (int i = x; i > 0; i -= (i & -i)) {
+    for (int j = y; j > 0; j -= (j & -j)) sum += tree[j * stride + i];
+  }
+  return sum;
+}
+
+void cOccupancyIndex::SetCell(int cell_id, const int counts[NUM_KINDS])
+{
+  assert(cell_id >= 0 && cell_id < m_world_x * m_world_y);
+  const int x = cell_id % m_world_x;
+  const int y = cell_id / m_world_x;
+  for (int k = 0; k < NUM_KINDS; k++) {
+    int& stored = m_cell_counts[cell_id * NUM_KINDS + k];
+    if (counts[k] != stored) {
+      add(k, x, y, counts[k] - stored);
+      stored = counts[k];
+    }
+  }
+}
+
+int cOccupancyIndex::Count(int kind, int min_x, int min_y, int max_x, int max_y) const
+{
+  if (min_x < 0) min_x = 0;
+  if (min_y < 0) min_y = 0;
+  if (max_x >= m_world_x) max_x = m_world_x - 1;
+  if (max_y >= m_world_y) max_y = m_world_y - 1;
+  if (min_x > max_x || min_y > max_y) return 0;
+  
+  return prefix(kind, max_x + 1, max_y + 1) - prefix(kind, min_x, max_y + 1)
+       - prefix(kind, max_x + 1, min_y) + prefix(kind, min_x, min_y);
+}
+
+int cOccupancyIndex::CountTorus(int kind, int min_x, int min_y, int max_x, int max_y) const
+{
+  if (min_x > max_x || min_y > max_y) return 0;
+  
+  // A span as wide as the world covers all of it; otherwise shift it to start inside the world and split it where it
+  // wraps past the far edge.
+  if (max_x - min_x + 1 >= m_world_x) {
+    min_x = 0;
+    max_x = m_world_x - 1;
+  } else {
+    const int shift = ((min_x % m_world_x) + m_world_x) % m_world_x - min_x;
+    min_x += shift;
+    max_x += shift;
+  }
+  if (max_y - min_y + 1 >= m_world_y) {
+    min_y = 0;
+    max_y = m_world_y - 1;
+  } else {
+    const int shift = ((min_y % m_world_y) + m_world_y) % m_world_y - min_y;
+    min_y += shift;
+    max_y += shift;
+  }
+  
+  int total = Count(kind, min_x, min_y, max_x, max_y);
+  if (max_x >= m_world_x) total += Count(kind, 0, min_y, max_x - m_world_x, max_y);
+  if (max_y >= m_world_y) total += Count(kind, min_x, 0, max_x, max_y - m_world_y);
+  if (max_x >= m_world_x && max_y >= m_world_y) total += Count(kind, 0, 0, max_x - m_world_x, max_y - m_world_y);
+  return total;
+}
+
+void cOccupancyIndex::WalkBounds(const Apto::Coord<int>& center, const Apto::Coord<int>& ahead, const Apto::Coord<int>& left,
+                                 const Apto::Coord<int>& right, int start, int end, Apto::Coord<int>& min_cell, Apto::Coord<int>& max_cell)
+{
+  min_cell = center;
+  max_cell = center;
+  const int end_dists[2] = { start, end };
+  for (int i = 0; i < 2; i++) {
+    const int dist = end_dists[i];
+    const Apto::Coord<int> dist_center = center + ahead * (dist - start);
+    const int num_cells_either_side = dist / 2;
+    const Apto::Coord<int> corners[3] = { dist_center, dist_center + left * num_cells_either_side, dist_center + right * num_cells_either_side };
+    for (int c = 0; c < 3; c++) {
+      min_cell.Set(Apto::Min(min_cell.X(), corners[c].X()), Apto::Min(min_cell.Y(), corners[c].Y()));
+      max_cell.Set(Apto::Max(max_cell.X(), corners[c].X()), Apto::Max(max_cell.Y(), corners[c].Y()));
+    }
+  }
+}
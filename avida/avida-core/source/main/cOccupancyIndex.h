@@ -0,0 +1,78 @@
+/*
+ *  cOccupancyIndex.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cOccupancyIndex_h
+#define cOccupancyIndex_h
+
+#include "apto/core.h"
+
+
+// Counts of the organisms and avatars occupying each cell of the world grid, kept in 2D Fenwick trees so that the
+// number of occupants of a given kind inside any rectangle of cells can be found in O(log x * log y).  cOrgSensor uses
+// this to skip look-ahead walks over regions that hold nothing it could be looking for.  The population reports every
+// change to a cell's occupants through SetCell(); cells are stored row-major, as in cPopulation.
+
+class cOccupancyIndex
+{
+public:
+  enum eKind {
+    ORG_PRED = 0,   // organisms with forage target -2
+    ORG_OTHER,      // all other organisms
+    AV_PRED,        // predator (input) avatars
+    AV_PREY,        // prey (output) avatars
+    NUM_KINDS
+  };
+  
+private:
+  int m_world_x;
+  int m_world_y;
+  Apto::Array<int> m_tree[NUM_KINDS];   // 1-based Fenwick trees, (m_world_x + 1) * (m_world_y + 1) entries each
+  Apto::Array<int> m_cell_counts;       // counts last reported for each cell, NUM_KINDS per cell
+  
+  void add(int kind, int x, int y, int delta);
+  int prefix(int kind, int x, int y) const;   // occupants of kind in cells [0, x) by [0, y)
+  
+  cOccupancyIndex(const cOccupancyIndex&); // @not_implemented
+  cOccupancyIndex& operator=(const cOccupancyIndex&); // @not_implemented
+  
+public:
+  cOccupancyIndex() : m_world_x(0), m_world_y(0) { ; }
+  
+  void Resize(int world_x, int world_y);
+  
+  // Record the current occupants of a cell; counts must hold NUM_KINDS entries
+  void SetCell(int cell_id, const int counts[NUM_KINDS]);
+  
+  // Occupants of kind in the inclusive rectangle [min_x, max_x] by [min_y, max_y], clipped to the world
+  int Count(int kind, int min_x, int min_y, int max_x, int max_y) const;
+  
+  // As Count(), but coordinates outside the world wrap around as on a torus
+  int CountTorus(int kind, int min_x, int min_y, int max_x, int max_y) const;
+  
+  // Bounding box of the cells a sensor walk can visit, before any wrapping.  The walk starts at center for distance
+  // start and takes one unit step along ahead per distance up to end; at each distance it also looks dist / 2 cells
+  // out along left and right.  Along each direction those cells move monotonically with distance, so the box is
+  // spanned by the cells at the two end distances.
+  static void WalkBounds(const Apto::Coord<int>& center, const Apto::Coord<int>& ahead, const Apto::Coord<int>& left,
+                         const Apto::Coord<int>& right, int start, int end, Apto::Coord<int>& min_cell, Apto::Coord<int>& max_cell);
+};
+
+#endif
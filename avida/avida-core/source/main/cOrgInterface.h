@@ -40,6 +40,7 @@ namespace Avida {
 
 class cAvidaContext;
 class cDeme;
+class cOccupancyIndex;
 class cOrganism;
 class cOrgMessage;
 class cOrgSinkMessage;
@@ -202,6 +203,8 @@ public:
   virtual void IncNumPreyOrganisms() = 0;
   virtual void IncNumPredOrganisms() = 0;
   virtual void IncNumTopPredOrganisms() = 0;
+  virtual void UpdateCellOccupancy() = 0;
+  virtual const cOccupancyIndex* GetOccupancyIndex() = 0;
   virtual void AttackFacedOrg(cAvidaContext& ctx, int loser) = 0;
 
   virtual void TryWriteBirthLocData(int org_idx) = 0;
@@ -24,6 +24,7 @@
 #include "cOrgSensor.h"
 
 #include "cEnvironment.h"
+#include "cOccupancyIndex.h"
 #include "cPopulationCell.h"
 #include "cResource.h"
 #include "cResourceCount.h"
@@ -389,6 +390,8 @@ cOrgSensor::sLookOut cOrgSensor::PreWalk(cAvidaContext& ctx, sLookInit& in_defs,
   
   int faced_cell_int = m_organism->GetOrgInterface().GetFacedCellID();
   if (m_use_avatar) faced_cell_int = m_organism->GetOrgInterface().GetAVFacedCellID();
+  // Without a faced cell (no neighbors) there is no direction to look in.
+  if (faced_cell_int < 0) return stuff_seen;
   
   Apto::Coord<int> faced_cell(faced_cell_int % worldx, faced_cell_int / worldx);
   Apto::Coord<int> center_cell(cell_id % worldx, cell_id / worldx);
@@ -425,6 +428,8 @@ cOrgSensor::sLookOut cOrgSensor::PreWalk(cAvidaContext& ctx, sLookInit& in_defs,
   
   if (!limits.visible) {     // nothing in range
     stuff_seen.report_type = 0;
+  } else if (in_defs.habitat == -2 && !MayFindOrgs(in_defs, limits, center_cell, ahead_dir, facing)) {
+    stuff_seen.report_type = 0;   // no one in range
   } else {
     if (m_world->GetConfig().WORLD_GEOMETRY.Get() == 2) WalkTorus(ctx, in_defs, facing, cell_id, limits, stuff_seen, center_cell, tot_bounds, worldBounds, val_res, this_cell, ahead_dir, worldx);
     else WalkCells(ctx, in_defs, facing, cell_id, limits, stuff_seen, center_cell, tot_bounds, worldBounds, val_res, this_cell, ahead_dir, worldx);
@@ -928,6 +933,47 @@ void cOrgSensor::SetWalkLimits(cAvidaContext& ctx, sLookInit& in_defs, sWalkLimi
   return;
 }
 
+// Checks the population's occupancy index for anything an organism search could count in the cells a walk would visit.
+// Returns false only when the box around those cells is provably empty, in which case walking would report nothing found.
+bool cOrgSensor::MayFindOrgs(sLookInit& in_defs, const sWalkLimits& limits, const Apto::Coord<int>& center_cell, const Apto::Coord<int>& ahead_dir, const int facing)
+{
+  const cOccupancyIndex* occupancy = m_organism->GetOrgInterface().GetOccupancyIndex();
+  if (occupancy == NULL) return true;
+  // a faced cell across a torus edge gives a step that is not a unit move, leave those to the walk
+  if (abs(ahead_dir.X()) > 1 || abs(ahead_dir.Y()) > 1) return true;
+  
+  Apto::Coord<int> left(0, 0);
+  Apto::Coord<int> right(0, 0);
+  SetCoords(left, right, facing);
+  
+  Apto::Coord<int> min_cell(0, 0);
+  Apto::Coord<int> max_cell(0, 0);
+  cOccupancyIndex::WalkBounds(center_cell, ahead_dir, left, right, limits.start, limits.end, min_cell, max_cell);
+  const int min_x = min_cell.X();
+  const int min_y = min_cell.Y();
+  const int max_x = max_cell.X();
+  const int max_y = max_cell.Y();
+  
+  int pred_kind = cOccupancyIndex::ORG_PRED;
+  int prey_kind = cOccupancyIndex::ORG_OTHER;
+  if (m_use_avatar) {
+    pred_kind = cOccupancyIndex::AV_PRED;
+    prey_kind = cOccupancyIndex::AV_PREY;
+  }
+  
+  const bool torus = (m_world->GetConfig().WORLD_GEOMETRY.Get() == 2);
+  int found = 0;
+  if (in_defs.search_type >= 0) {
+    if (torus) found += occupancy->CountTorus(pred_kind, min_x, min_y, max_x, max_y);
+    else found += occupancy->Count(pred_kind, min_x, min_y, max_x, max_y);
+  }
+  if (in_defs.search_type <= 0) {
+    if (torus) found += occupancy->CountTorus(prey_kind, min_x, min_y, max_x, max_y);
+    else found += occupancy->Count(prey_kind, min_x, min_y, max_x, max_y);
+  }
+  return (found > 0);
+}
+
 void cOrgSensor::SetCoords(Apto::Coord<int>& left, Apto::Coord<int>& right, const int facing)
 {
   switch (facing) {
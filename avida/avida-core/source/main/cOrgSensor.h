@@ -124,6 +124,7 @@ class cOrgSensor
   sLookOut PreWalk(cAvidaContext& ctx, sLookInit& in_defs, const int facing, const int cell_id);
   void SetWalkLimits(cAvidaContext& ctx, sLookInit& in_defs, sWalkLimits& limits, sBounds& worldBounds, sBounds& tot_bounds, Apto::Array<int, Apto::Smart>& val_res, int worldx, Apto::Coord<int>& this_cell, int facing, int cell, Apto::Coord<int>& center_cell, const Apto::Coord<int>& ahead_dir);
   void SetCoords(Apto::Coord<int>& left, Apto::Coord<int>& right, const int facing);
+  bool MayFindOrgs(sLookInit& in_defs, const sWalkLimits& limits, const Apto::Coord<int>& center_cell, const Apto::Coord<int>& ahead_dir, const int facing);
   
   void WalkCells(cAvidaContext& ctx, sLookInit& in_defs, const int facing, const int cell_id, sWalkLimits& limits, sLookOut& stuff_seen, Apto::Coord<int>& center_cell, sBounds& tot_bounds, sBounds& worldBounds, const Apto::Array<int, Apto::Smart>& val_res, Apto::Coord<int>& this_cell, const Apto::Coord<int>& ahead_dir, const int& worldx);
 
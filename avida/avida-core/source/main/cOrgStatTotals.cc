@@ -0,0 +1,252 @@
+/*
+ *  cOrgStatTotals.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cOrgStatTotals.h"
+
+#include "cHardwareBase.h"
+#include "cOrganism.h"
+#include "cPhenotype.h"
+
+#include <cfloat>
+#include <climits>
+#include <cmath>
+
+
+void cOrgStatTotals::Reset(int num_tasks, int num_reactions)
+{
+  fitness.Clear();
+  merit.Clear();
+  gestation.Clear();
+  creature_age.Clear();
+  generation.Clear();
+  neutral_metric.Clear();
+  lineage_label.Clear();
+  copy_size.Clear();
+  exe_size.Clear();
+  mem_size.Clear();
+  copy_mut_rate.Clear();
+  log_copy_mut_rate.Clear();
+  div_mut_rate.Clear();
+  log_div_mut_rate.Clear();
+  
+  num_breed_true = 0;
+  num_parasites = 0;
+  num_no_birth = 0;
+  num_multi_thread = 0;
+  num_single_thread = 0;
+  num_threads = 0;
+  num_modified = 0;
+  
+  max_merit = cMerit(0);
+  max_fitness = 0;
+  max_gestation_time = 0;
+  max_genome_length = 0;
+  min_merit = cMerit(FLT_MAX);
+  min_fitness = FLT_MAX;
+  min_gestation_time = INT_MAX;
+  min_genome_length = INT_MAX;
+  
+  task_cur_count.ResizeClear(num_tasks);           task_cur_count.SetAll(0);
+  task_cur_quality.ResizeClear(num_tasks);         task_cur_quality.SetAll(0.0);
+  task_cur_max_quality.ResizeClear(num_tasks);     task_cur_max_quality.SetAll(0.0);
+  task_last_count.ResizeClear(num_tasks);          task_last_count.SetAll(0);
+  task_last_quality.ResizeClear(num_tasks);        task_last_quality.SetAll(0.0);
+  task_last_max_quality.ResizeClear(num_tasks);    task_last_max_quality.SetAll(0.0);
+  task_exe_count.ResizeClear(num_tasks);           task_exe_count.SetAll(0);
+  host_task_cur_count.ResizeClear(num_tasks);      host_task_cur_count.SetAll(0);
+  host_task_last_count.ResizeClear(num_tasks);     host_task_last_count.SetAll(0);
+  parasite_task_cur_count.ResizeClear(num_tasks);  parasite_task_cur_count.SetAll(0);
+  parasite_task_last_count.ResizeClear(num_tasks); parasite_task_last_count.SetAll(0);
+  internal_task_cur_count.ResizeClear(num_tasks);          internal_task_cur_count.SetAll(0);
+  internal_task_cur_quality.ResizeClear(num_tasks);        internal_task_cur_quality.SetAll(0.0);
+  internal_task_cur_max_quality.ResizeClear(num_tasks);    internal_task_cur_max_quality.SetAll(0.0);
+  internal_task_last_count.ResizeClear(num_tasks);         internal_task_last_count.SetAll(0);
+  internal_task_last_quality.ResizeClear(num_tasks);       internal_task_last_quality.SetAll(0.0);
+  internal_task_last_max_quality.ResizeClear(num_tasks);   internal_task_last_max_quality.SetAll(0.0);
+  
+  reaction_cur_count.ResizeClear(num_reactions);        reaction_cur_count.SetAll(0);
+  reaction_cur_add_reward.ResizeClear(num_reactions);   reaction_cur_add_reward.SetAll(0.0);
+  reaction_last_count.ResizeClear(num_reactions);       reaction_last_count.SetAll(0);
+  reaction_last_add_reward.ResizeClear(num_reactions);  reaction_last_add_reward.SetAll(0.0);
+  reaction_exe_count.ResizeClear(num_reactions);        reaction_exe_count.SetAll(0);
+}
+
+
+void cOrgStatTotals::AddOrganism(cOrganism* organism)
+{
+  const cPhenotype& phenotype = organism->GetPhenotype();
+  const cMerit cur_merit = phenotype.GetMerit();
+  const double cur_fitness = phenotype.GetFitness();
+  const int cur_gestation_time = phenotype.GetGestationTime();
+  const int cur_genome_length = phenotype.GetGenomeLength();
+  
+  fitness.Add(cur_fitness);
+  merit.Add(cur_merit.GetDouble());
+  gestation.Add(phenotype.GetGestationTime());
+  creature_age.Add(phenotype.GetAge());
+  generation.Add(phenotype.GetGeneration());
+  neutral_metric.Add(phenotype.GetNeutralMetric());
+  lineage_label.Add(organism->GetLineageLabel());
+  copy_mut_rate.Push(organism->MutationRates().GetCopyMutProb());
+  log_copy_mut_rate.Push(log(organism->MutationRates().GetCopyMutProb()));
+  div_mut_rate.Push(organism->MutationRates().GetDivMutProb() / phenotype.GetDivType());
+  log_div_mut_rate.Push(log(organism->MutationRates().GetDivMutProb() / phenotype.GetDivType()));
+  copy_size.Add(phenotype.GetCopiedSize());
+  exe_size.Add(phenotype.GetExecutedSize());
+  
+  if (cur_merit > max_merit) max_merit = cur_merit;
+  if (cur_fitness > max_fitness) max_fitness = cur_fitness;
+  if (cur_gestation_time > max_gestation_time) max_gestation_time = cur_gestation_time;
+  if (cur_genome_length > max_genome_length) max_genome_length = cur_genome_length;
+  
+  if (cur_merit < min_merit) min_merit = cur_merit;
+  if (cur_fitness < min_fitness) min_fitness = cur_fitness;
+  if (cur_gestation_time < min_gestation_time) min_gestation_time = cur_gestation_time;
+  if (cur_genome_length < min_genome_length) min_genome_length = cur_genome_length;
+  
+  // Test what tasks this creatures has completed.
+  for (int j = 0; j < task_cur_count.GetSize(); j++) {
+    if (phenotype.GetCurTaskCount()[j] > 0) {
+      task_cur_count[j]++;
+      const double quality = phenotype.GetCurTaskQuality()[j];
+      task_cur_quality[j] += quality;
+      if (quality > task_cur_max_quality[j]) task_cur_max_quality[j] = quality;
+    }
+    
+    if (phenotype.GetLastTaskCount()[j] > 0) {
+      task_last_count[j]++;
+      const double quality = phenotype.GetLastTaskQuality()[j];
+      task_last_quality[j] += quality;
+      if (quality > task_last_max_quality[j]) task_last_max_quality[j] = quality;
+      task_exe_count[j] += phenotype.GetLastTaskCount()[j];
+    }
+    
+    if (phenotype.GetCurHostTaskCount()[j] > 0) host_task_cur_count[j]++;
+    if (phenotype.GetLastHostTaskCount()[j] > 0) host_task_last_count[j]++;
+    if (phenotype.GetCurParasiteTaskCount()[j] > 0) parasite_task_cur_count[j]++;
+    if (phenotype.GetLastParasiteTaskCount()[j] > 0) parasite_task_last_count[j]++;
+    
+    if (phenotype.GetCurInternalTaskCount()[j] > 0) {
+      internal_task_cur_count[j]++;
+      const double quality = phenotype.GetCurInternalTaskQuality()[j];
+      internal_task_cur_quality[j] += quality;
+      if (quality > internal_task_cur_max_quality[j]) internal_task_cur_max_quality[j] = quality;
+    }
+    
+    if (phenotype.GetLastInternalTaskCount()[j] > 0) {
+      internal_task_last_count[j]++;
+      const double quality = phenotype.GetLastInternalTaskQuality()[j];
+      internal_task_last_quality[j] += quality;
+      if (quality > internal_task_last_max_quality[j]) internal_task_last_max_quality[j] = quality;
+    }
+  }
+  
+  // Record what add bonuses this organism garnered for different reactions
+  for (int j = 0; j < reaction_cur_count.GetSize(); j++) {
+    if (phenotype.GetCurReactionCount()[j] > 0) {
+      reaction_cur_count[j]++;
+      reaction_cur_add_reward[j] += phenotype.GetCurReactionAddReward()[j];
+    }
+    
+    if (phenotype.GetLastReactionCount()[j] > 0) {
+      reaction_last_count[j]++;
+      reaction_exe_count[j] += phenotype.GetLastReactionCount()[j];
+      reaction_last_add_reward[j] += phenotype.GetLastReactionAddReward()[j];
+    }
+  }
+  
+  // Increment the counts for all qualities the organism has...
+  num_parasites += organism->GetNumParasites();
+  if (phenotype.ParentTrue()) num_breed_true++;
+  if (phenotype.GetNumDivides() == 0) num_no_birth++;
+  if (phenotype.IsMultiThread()) num_multi_thread++;
+  else num_single_thread++;
+  
+  if (phenotype.IsModified()) num_modified++;
+  
+  cHardwareBase& hardware = organism->GetHardware();
+  mem_size.Add(hardware.GetMemory().GetSize());
+  num_threads += hardware.GetNumThreads();
+}
+
+
+void cOrgStatTotals::Merge(const cOrgStatTotals& other)
+{
+  fitness.Merge(other.fitness);
+  merit.Merge(other.merit);
+  gestation.Merge(other.gestation);
+  creature_age.Merge(other.creature_age);
+  generation.Merge(other.generation);
+  neutral_metric.Merge(other.neutral_metric);
+  lineage_label.Merge(other.lineage_label);
+  copy_size.Merge(other.copy_size);
+  exe_size.Merge(other.exe_size);
+  mem_size.Merge(other.mem_size);
+  copy_mut_rate.Merge(other.copy_mut_rate);
+  log_copy_mut_rate.Merge(other.log_copy_mut_rate);
+  div_mut_rate.Merge(other.div_mut_rate);
+  log_div_mut_rate.Merge(other.log_div_mut_rate);
+  
+  num_breed_true += other.num_breed_true;
+  num_parasites += other.num_parasites;
+  num_no_birth += other.num_no_birth;
+  num_multi_thread += other.num_multi_thread;
+  num_single_thread += other.num_single_thread;
+  num_threads += other.num_threads;
+  num_modified += other.num_modified;
+  
+  if (other.max_merit > max_merit) max_merit = other.max_merit;
+  if (other.max_fitness > max_fitness) max_fitness = other.max_fitness;
+  if (other.max_gestation_time > max_gestation_time) max_gestation_time = other.max_gestation_time;
+  if (other.max_genome_length > max_genome_length) max_genome_length = other.max_genome_length;
+  if (other.min_merit < min_merit) min_merit = other.min_merit;
+  if (other.min_fitness < min_fitness) min_fitness = other.min_fitness;
+  if (other.min_gestation_time < min_gestation_time) min_gestation_time = other.min_gestation_time;
+  if (other.min_genome_length < min_genome_length) min_genome_length = other.min_genome_length;
+  
+  for (int j = 0; j < task_cur_count.GetSize(); j++) {
+    task_cur_count[j] += other.task_cur_count[j];
+    task_cur_quality[j] += other.task_cur_quality[j];
+    task_cur_max_quality[j] = Apto::Max(task_cur_max_quality[j], other.task_cur_max_quality[j]);
+    task_last_count[j] += other.task_last_count[j];
+    task_last_quality[j] += other.task_last_quality[j];
+    task_last_max_quality[j] = Apto::Max(task_last_max_quality[j], other.task_last_max_quality[j]);
+    task_exe_count[j] += other.task_exe_count[j];
+    host_task_cur_count[j] += other.host_task_cur_count[j];
+    host_task_last_count[j] += other.host_task_last_count[j];
+    parasite_task_cur_count[j] += other.parasite_task_cur_count[j];
+    parasite_task_last_count[j] += other.parasite_task_last_count[j];
+    internal_task_cur_count[j] += other.internal_task_cur_count[j];
+    internal_task_cur_quality[j] += other.internal_task_cur_quality[j];
+    internal_task_cur_max_quality[j] = Apto::Max(internal_task_cur_max_quality[j], other.internal_task_cur_max_quality[j]);
+    internal_task_last_count[j] += other.internal_task_last_count[j];
+    internal_task_last_quality[j] += other.internal_task_last_quality[j];
+    internal_task_last_max_quality[j] = Apto::Max(internal_task_last_max_quality[j], other.internal_task_last_max_quality[j]);
+  }
+  
+  for (int j = 0; j < reaction_cur_count.GetSize(); j++) {
+    reaction_cur_count[j] += other.reaction_cur_count[j];
+    reaction_cur_add_reward[j] += other.reaction_cur_add_reward[j];
+    reaction_last_count[j] += other.reaction_last_count[j];
+    reaction_last_add_reward[j] += other.reaction_last_add_reward[j];
+    reaction_exe_count[j] += other.reaction_exe_count[j];
+  }
+}
@@ -0,0 +1,108 @@
+/*
+ *  cOrgStatTotals.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cOrgStatTotals_h
+#define cOrgStatTotals_h
+
+#include "avida/core/Types.h"
+
+#include "cDoubleSum.h"
+#include "cMerit.h"
+#include "cRunningStats.h"
+
+class cOrganism;
+
+
+// Per-update organism statistics for one slice of the population.  cPopulation::UpdateOrganismStats() fills one of
+// these per fixed-size chunk of live organisms (in parallel when a worker pool is available), merges them in chunk
+// order, and hands the result to cStats.  Since the chunking does not depend on the number of threads, neither do the
+// results.  Members are public; this is a plain accumulator.
+
+class cOrgStatTotals
+{
+public:
+  cDoubleSum fitness;
+  cDoubleSum merit;
+  cDoubleSum gestation;
+  cDoubleSum creature_age;
+  cDoubleSum generation;
+  cDoubleSum neutral_metric;
+  cDoubleSum lineage_label;
+  cDoubleSum copy_size;
+  cDoubleSum exe_size;
+  cDoubleSum mem_size;
+  cRunningStats copy_mut_rate;
+  cRunningStats log_copy_mut_rate;
+  cRunningStats div_mut_rate;
+  cRunningStats log_div_mut_rate;
+  
+  int num_breed_true;
+  int num_parasites;
+  int num_no_birth;
+  int num_multi_thread;
+  int num_single_thread;
+  int num_threads;
+  int num_modified;
+  
+  cMerit max_merit;
+  double max_fitness;
+  int max_gestation_time;
+  int max_genome_length;
+  cMerit min_merit;
+  double min_fitness;
+  int min_gestation_time;
+  int min_genome_length;
+  
+  // Per task: number of organisms doing it, summed and maximum quality, and (last) total executions
+  Apto::Array<int> task_cur_count;
+  Apto::Array<double> task_cur_quality;
+  Apto::Array<double> task_cur_max_quality;
+  Apto::Array<int> task_last_count;
+  Apto::Array<double> task_last_quality;
+  Apto::Array<double> task_last_max_quality;
+  Apto::Array<int> task_exe_count;
+  Apto::Array<int> host_task_cur_count;
+  Apto::Array<int> host_task_last_count;
+  Apto::Array<int> parasite_task_cur_count;
+  Apto::Array<int> parasite_task_last_count;
+  Apto::Array<int> internal_task_cur_count;
+  Apto::Array<double> internal_task_cur_quality;
+  Apto::Array<double> internal_task_cur_max_quality;
+  Apto::Array<int> internal_task_last_count;
+  Apto::Array<double> internal_task_last_quality;
+  Apto::Array<double> internal_task_last_max_quality;
+  
+  // Per reaction: number of organisms triggering it, summed add rewards, and (last) total executions
+  Apto::Array<int> reaction_cur_count;
+  Apto::Array<double> reaction_cur_add_reward;
+  Apto::Array<int> reaction_last_count;
+  Apto::Array<double> reaction_last_add_reward;
+  Apto::Array<int> reaction_exe_count;
+  
+  
+  cOrgStatTotals() { Reset(0, 0); }
+  
+  void Reset(int num_tasks, int num_reactions);
+  void AddOrganism(cOrganism* organism);
+  void Merge(const cOrgStatTotals& other);
+};
+
+#endif
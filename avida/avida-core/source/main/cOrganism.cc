@@ -456,6 +456,7 @@ void cOrganism::doOutput(cAvidaContext& ctx,
 
   cTaskContext taskctx(this, input_buffer, output_buffer, other_input_list, other_output_list,
                        m_hardware->GetExtendedMemory(), on_divide, received_messages_point);
+  taskctx.SetLogicIdentifier(&m_logic_ident);
 
   //combine global and deme resource counts
   Apto::Array<double> globalAndDeme_resource_count = global_resource_count + deme_resource_count;
@@ -574,6 +575,7 @@ void cOrganism::doAVOutput(cAvidaContext& ctx,
 
   cTaskContext taskctx(this, input_buffer, output_buffer, other_input_list, other_output_list,
                        m_hardware->GetExtendedMemory(), on_divide, received_messages_point);
+  taskctx.SetLogicIdentifier(&m_logic_ident);
 
   //combine global and deme resource counts
   const Apto::Array<double>& av_res_count = m_interface->GetAVResources(ctx);
@@ -1263,6 +1265,7 @@ void cOrganism::SetForageTarget(cAvidaContext& ctx, int forage_target, bool inje
   }
   m_forage_target = forage_target;
   if (m_show_ft == -1) m_show_ft = m_forage_target;
+  if (m_interface) m_interface->UpdateCellOccupancy();
 }
 
 void cOrganism::CopyParentFT(cAvidaContext& ctx) {
@@ -29,6 +29,7 @@
 #include "avida/private/systematics/GenomeTestMetrics.h"
 
 #include "cCPUMemory.h"
+#include "cLogicIdentifier.h"
 #include "cMutationRates.h"
 #include "cPhenotype.h"
 #include "cOrgInterface.h"
@@ -90,6 +91,7 @@ private:
   tBuffer<int> m_input_buf;
   tBuffer<int> m_output_buf;
   tBuffer<int> m_received_messages;
+  cLogicIdentifier m_logic_ident;          // Input masks for the output logic tests, kept while inputs are unchanged
 
   int m_cur_sg;
 
@@ -43,6 +43,8 @@
 #include "AvidaTools.h"
 
 #include "cAvidaContext.h"
+#include "cBatchProbSchedule.h"
+#include "cDemeBlockSchedule.h"
 #include "cCPUTestInfo.h"
 #include "cCodeLabel.h"
 #include "cDemePlaceholderUnit.h"
@@ -61,6 +63,7 @@
 #include "cStats.h"
 #include "cTestCPU.h"
 #include "cTopology.h"
+#include "cWorkerPool.h"
 #include "cWorld.h"
 
 #include "cHardwareCPU.h"
@@ -265,6 +268,10 @@ public:
 cPopulation::cPopulation(cWorld* world)
 : m_world(world)
 , m_scheduler(NULL)
+, m_worker_pool(NULL)
+, m_well_mixed(false)
+, m_deme_res_steps(0)
+, m_deme_res_step_size(0.0)
 , birth_chamber(world)
 , print_mini_trace_genomes(false)
 , use_micro_traces(false)
@@ -296,6 +303,8 @@ cPopulation::cPopulation(cWorld* world)
   assert(!(m_world->GetConfig().DEMES_USE_GERMLINE.Get() && (m_world->GetConfig().MIGRATION_RATE.Get()>0.0)));
 
 
+  if (m_world->GetConfig().WORKER_THREADS.Get() > 1) m_worker_pool = new cWorkerPool(m_world->GetConfig().WORKER_THREADS.Get());
+
   SetupCellGrid();
 
   Data::ArgumentedProviderActivateFunctor activate(m_world, &cWorld::GetPopulationProvider);
@@ -332,12 +341,22 @@ void cPopulation::SetupCellGrid()
   if (num_demes <= 0) num_demes = 1; // One population == one deme.
   assert(num_demes == 1 || m_world->GetConfig().BIRTH_METHOD.Get() != POSITION_OFFSPRING_FULL_SOUP_ELDEST);
 
+  // A well-mixed population is only placed into by population-wide birth methods, so it needs no topology.
+  m_well_mixed = (geometry == nGeometry::WELL_MIXED);
+  if (m_well_mixed) {
+    const int birth_method = m_world->GetConfig().BIRTH_METHOD.Get();
+    if (birth_method < NUM_LOCAL_POSITION_OFFSPRING || birth_method == POSITION_OFFSPRING_PARENT_FACING ||
+        birth_method == POSITION_OFFSPRING_NEIGHBORHOOD_ENERGY_USED || birth_method == POSITION_OFFSPRING_DISPERSAL) {
+      m_world->GetDriver().Feedback().Error("WORLD_GEOMETRY 9 (well-mixed) requires a population-wide BIRTH_METHOD.");
+      m_world->GetDriver().Abort(Avida::INVALID_CONFIG);
+    }
+  }
+
   // Allocate the cells, resources, and market.
   cell_array.ResizeClear(num_cells);
   empty_cell_id_array.ResizeClear(cell_array.GetSize());
-  for (int i = 0; i < empty_cell_id_array.GetSize(); i++) {
-    empty_cell_id_array[i] = i;
-  }
+  if (m_well_mixed) m_occupancy.Resize(0, 0);
+  else m_occupancy.Resize(world_x, world_y);
 
   // Setup the cells.  Do things that are not dependent upon topology here.
   bool fill_reaper_queue = (m_world->GetConfig().BIRTH_METHOD.Get() == POSITION_OFFSPRING_FULL_SOUP_ELDEST);
@@ -351,6 +370,7 @@ void cPopulation::SetupCellGrid()
   const int deme_size_y = world_y / num_demes;
   const int deme_size = deme_size_x * deme_size_y;
   deme_array.ResizeClear(num_demes);
+  m_empty_cells.Resize(num_cells, deme_size);
 
   // Broken setting:
   assert(m_world->GetConfig().DEMES_REPLICATE_SIZE.Get() <= deme_size);
@@ -396,10 +416,13 @@ void cPopulation::SetupCellGrid()
                          m_world->GetConfig().SCALE_FREE_ALPHA.Get(), m_world->GetConfig().SCALE_FREE_ZERO_APPEAL.Get(),
                          m_world->GetRandom());
         break;
+      case nGeometry::WELL_MIXED:
+        break;
       default:
         assert(false);
     }
   }
+  BuildNeighborTable();
 
   BuildTimeSlicer();
 
@@ -415,6 +438,7 @@ void cPopulation::SetupCellGrid()
   cResourceCount tmp_res_count(resource_lib.GetSize() - num_deme_res);
   resource_count = tmp_res_count;
   resource_count.ResizeSpatialGrids(world_x, world_y);
+  resource_count.SetWorkerPool(m_worker_pool);
 
   for(int i = 0; i < GetNumDemes(); i++) {
     cResourceCount tmp_deme_res_count(num_deme_res);
@@ -487,6 +511,57 @@ void cPopulation::SetupCellGrid()
 
 
 
+// Moves the connections made by the topology builders into one table, so that neighbor lookups index an array
+// rather than walk list nodes, and rotating a cell is an index change.
+void cPopulation::BuildNeighborTable()
+{
+  int total = 0;
+  for (int i = 0; i < cell_array.GetSize(); i++) total += cell_array[i].m_connections.GetSize();
+  m_neighbor_table.ResizeClear(total);
+
+  int offset = 0;
+  for (int i = 0; i < cell_array.GetSize(); i++) {
+    cPopulationCell& cell = cell_array[i];
+    cell.m_num_neighbors = cell.m_connections.GetSize();
+    cell.m_facing = 0;
+    while (cell.m_connections.GetSize() > 0) m_neighbor_table[offset++] = cell.m_connections.Pop()->GetID();
+  }
+  AssignNeighborRows();
+}
+
+// Points each cell at its row, given the rows are packed in cell order
+void cPopulation::AssignNeighborRows()
+{
+  int offset = 0;
+  for (int i = 0; i < cell_array.GetSize(); i++) {
+    cPopulationCell& cell = cell_array[i];
+    cell.m_cells = &cell_array[0];
+    cell.m_neighbors = (cell.m_num_neighbors > 0) ? &m_neighbor_table[offset] : NULL;
+    offset += cell.m_num_neighbors;
+  }
+}
+
+// Adds neighbor to the connections of cell, either as the cell faced or as the last neighbor before it.  Rows are
+// packed, so the table is repacked with room for the new entry (rows keep their order, starting from the cell faced).
+void cPopulation::ConnectCells(cPopulationCell& cell, cPopulationCell& neighbor, bool face)
+{
+  int total = 1;
+  for (int i = 0; i < cell_array.GetSize(); i++) total += cell_array[i].m_num_neighbors;
+
+  Apto::Array<int> table(total);
+  int offset = 0;
+  for (int i = 0; i < cell_array.GetSize(); i++) {
+    cPopulationCell& cur = cell_array[i];
+    if (&cur == &cell && face) table[offset++] = neighbor.GetID();
+    for (int j = 0; j < cur.m_num_neighbors; j++) table[offset++] = cur.GetNeighbor(j).GetID();
+    if (&cur == &cell && !face) table[offset++] = neighbor.GetID();
+    if (&cur == &cell) cur.m_num_neighbors++;
+    cur.m_facing = 0;
+  }
+  m_neighbor_table = table;
+  AssignNeighborRows();
+}
+
 void cPopulation::ResizeCellGrid(int x, int y)
 {
   ClearCellGrid();
@@ -495,6 +570,24 @@ void cPopulation::ResizeCellGrid(int x, int y)
   SetupCellGrid();
 }
 
+void cPopulation::UpdateCellOccupancy(int cell_id)
+{
+  const cPopulationCell& cell = cell_array[cell_id];
+  m_empty_cells.SetEmpty(cell_id, !cell.IsOccupied());
+  if (m_well_mixed) return;
+
+  int counts[cOccupancyIndex::NUM_KINDS];
+  counts[cOccupancyIndex::ORG_PRED] = 0;
+  counts[cOccupancyIndex::ORG_OTHER] = 0;
+  if (cell.IsOccupied()) {
+    if (cell.GetOrganism()->GetForageTarget() == -2) counts[cOccupancyIndex::ORG_PRED] = 1;
+    else counts[cOccupancyIndex::ORG_OTHER] = 1;
+  }
+  counts[cOccupancyIndex::AV_PRED] = cell.GetNumPredAV();
+  counts[cOccupancyIndex::AV_PREY] = cell.GetNumPreyAV();
+  m_occupancy.SetCell(cell_id, counts);
+}
+
 
 
 
@@ -604,6 +697,7 @@ cPopulation::~cPopulation()
 {
   for (int i = 0; i < cell_array.GetSize(); i++) delete cell_array[i].GetOrganism();
   delete m_scheduler;
+  delete m_worker_pool;
 }
 
 
@@ -1225,9 +1319,13 @@ bool cPopulation::ActivateParasite(cOrganism* host, Systematics::UnitPtr parent,
         target_organism = rand_cell.GetOrganism();
       }
     }
+    else if (host_cell.GetNumNeighbors() == 0) {
+      // A well-mixed world has no neighborhood, so the target is drawn from the whole population
+      target_organism = GetCell(m_world->GetRandom().GetUInt(cell_array.GetSize())).GetOrganism();
+    }
     else {
       target_organism =
-      host_cell.ConnectionList().GetPos(m_world->GetRandom().GetUInt(host->GetNeighborhoodSize()))->GetOrganism();
+      host_cell.GetNeighbor(m_world->GetRandom().GetUInt(host->GetNeighborhoodSize())).GetOrganism();
     }
   }
 
@@ -1325,6 +1423,7 @@ bool cPopulation::ActivateOrganism(cAvidaContext& ctx, cOrganism* in_organism, c
 
   ConstInstructionSequencePtr seq;
   seq.DynamicCastFrom(in_organism->GetGenome().Representation());
+  seq->Fingerprint(); // cached on the organism's genome, and carried by the copy handed to the signal
 
   InstructionSequence* nseq = new InstructionSequence(*seq);
   m_world->curr_genome = in_organism->GetGenome();
@@ -2127,10 +2226,10 @@ bool cPopulation::MoveOrganisms(cAvidaContext& ctx, int src_cell_id, int dest_ce
 
     // Find neighborhood size for facing
     if (NULL != dest_cell.GetOrganism()) {
-      actualNeighborhoodSize = dest_cell.ConnectionList().GetSize();
+      actualNeighborhoodSize = dest_cell.GetNumNeighbors();
     } else {
       if (NULL != src_cell.GetOrganism()) {
-        actualNeighborhoodSize = src_cell.ConnectionList().GetSize();
+        actualNeighborhoodSize = src_cell.GetNumNeighbors();
       } else {
         // Punt
         actualNeighborhoodSize = 8;
@@ -2148,7 +2247,7 @@ bool cPopulation::MoveOrganisms(cAvidaContext& ctx, int src_cell_id, int dest_ce
     newFacing = destFacing;
     for(int i = 0; i < actualNeighborhoodSize; i++) {
       if (src_cell.GetFacing() != newFacing) {
-        src_cell.ConnectionList().CircNext();
+        src_cell.RotateNext();
         //cout << "MO: src_cell facing not yet at " << newFacing << endl;
       } else {
         //cout << "MO: src_cell facing successfully set to " << newFacing << endl;
@@ -2162,7 +2261,7 @@ bool cPopulation::MoveOrganisms(cAvidaContext& ctx, int src_cell_id, int dest_ce
     newFacing = fromFacing;
     for(int i = 0; i < actualNeighborhoodSize; i++) {
       if (dest_cell.GetFacing() != newFacing) {
-        dest_cell.ConnectionList().CircNext();
+        dest_cell.RotateNext();
         // cout << "MO: dest_cell facing not yet at " << newFacing << endl;
       } else {
         // cout << "MO: dest_cell facing successfully set to " << newFacing << endl;
@@ -4248,9 +4347,9 @@ void cPopulation::DemePostInjection(cDeme& deme, cPopulationCell& cell) {
       break;
     }
     case 2: { // Spin cell to face randomly.
-      const int rotate_count = m_world->GetRandom().GetInt(0, cell.ConnectionList().GetSize());
+      const int rotate_count = m_world->GetRandom().GetInt(0, cell.GetNumNeighbors());
       for(int i=0; i<rotate_count; ++i) {
-        cell.ConnectionList().CircNext();
+        cell.RotateNext();
       }
       break;
     }
@@ -4540,15 +4639,43 @@ void cPopulation::AddDemePred(cString type, int times) {
 void cPopulation::CheckImplicitDemeRepro(cDeme& deme, cAvidaContext& ctx) {
 
   if (GetNumDemes() <= 1) return;
+  const bool deme_block = (m_world->GetConfig().SLICING_METHOD.Get() == SLICE_DEME_BLOCK);
+  if (deme_block && deme.IsReproPending()) return;
+
+  const bool replicate = (m_world->GetConfig().DEMES_REPLICATE_CPU_CYCLES.Get()
+      && (deme.GetTimeUsed() >= m_world->GetConfig().DEMES_REPLICATE_CPU_CYCLES.Get()))
+    || (m_world->GetConfig().DEMES_REPLICATE_TIME.Get()
+      && (deme.GetNormalizedTimeUsed() >= m_world->GetConfig().DEMES_REPLICATE_TIME.Get()))
+    || (m_world->GetConfig().DEMES_REPLICATE_BIRTHS.Get()
+      && (deme.GetBirthCount() >= m_world->GetConfig().DEMES_REPLICATE_BIRTHS.Get()))
+    || (m_world->GetConfig().DEMES_REPLICATE_ORGS.Get()
+      && (deme.GetOrgCount() >= m_world->GetConfig().DEMES_REPLICATE_ORGS.Get()));
+  if (!replicate) return;
+
+  // Deme block scheduling keeps demes independent within an update; replication, which reaches into another deme,
+  // waits for the end of the update.
+  if (deme_block) {
+    deme.SetReproPending(true);
+    m_pending_deme_repro.Push(deme.GetID());
+  } else {
+    ReplicateDeme(deme, ctx);
+  }
+}
+
+// Replicates the demes marked by CheckImplicitDemeRepro, in deme order.  A marked deme that has been replaced by
+// another's offspring in the meantime is no longer marked, and is skipped.
+void cPopulation::ReplicatePendingDemes(cAvidaContext& ctx)
+{
+  if (m_pending_deme_repro.GetSize() == 0) return;
 
-  if (m_world->GetConfig().DEMES_REPLICATE_CPU_CYCLES.Get()
-      && (deme.GetTimeUsed() >= m_world->GetConfig().DEMES_REPLICATE_CPU_CYCLES.Get())) ReplicateDeme(deme, ctx);
-  else if (m_world->GetConfig().DEMES_REPLICATE_TIME.Get()
-           && (deme.GetNormalizedTimeUsed() >= m_world->GetConfig().DEMES_REPLICATE_TIME.Get())) ReplicateDeme(deme, ctx);
-  else if (m_world->GetConfig().DEMES_REPLICATE_BIRTHS.Get()
-           && (deme.GetBirthCount() >= m_world->GetConfig().DEMES_REPLICATE_BIRTHS.Get())) ReplicateDeme(deme, ctx);
-  else if (m_world->GetConfig().DEMES_REPLICATE_ORGS.Get()
-           && (deme.GetOrgCount() >= m_world->GetConfig().DEMES_REPLICATE_ORGS.Get())) ReplicateDeme(deme, ctx);
+  std::sort(&m_pending_deme_repro[0], &m_pending_deme_repro[0] + m_pending_deme_repro.GetSize());
+  for (int i = 0; i < m_pending_deme_repro.GetSize(); i++) {
+    cDeme& deme = GetDeme(m_pending_deme_repro[i]);
+    if (!deme.IsReproPending()) continue;
+    deme.SetReproPending(false);
+    ReplicateDeme(deme, ctx);
+  }
+  m_pending_deme_repro.Resize(0);
 }
 
 // Print out all statistics about individual demes
@@ -5400,31 +5527,31 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
   tList<cPopulationCell> found_list;
 
   // First, check if there is an empty organism to work with (always preferred)
-  tList<cPopulationCell>& conn_list = parent_cell.ConnectionList();
-
   const bool prefer_empty = m_world->GetConfig().PREFER_EMPTY.Get();
 
-  if (birth_method == POSITION_OFFSPRING_DISPERSAL && conn_list.GetSize() > 0) {
-    tList<cPopulationCell>* disp_list = &conn_list;
+  if (birth_method == POSITION_OFFSPRING_DISPERSAL && parent_cell.GetNumNeighbors() > 0) {
+    const cPopulationCell* disp_cell = &parent_cell;
 
     // hop through connection lists based on the dispersal rate
     int hops = ctx.GetRandom().GetRandPoisson(m_world->GetConfig().DISPERSAL_RATE.Get());
     for (int i = 0; i < hops; i++) {
-      disp_list = &(disp_list->GetPos(ctx.GetRandom().GetUInt(disp_list->GetSize()))->ConnectionList());
-      if (disp_list->GetSize() == 0) break;
+      disp_cell = &disp_cell->GetNeighbor(ctx.GetRandom().GetUInt(disp_cell->GetNumNeighbors()));
+      if (disp_cell->GetNumNeighbors() == 0) break;
     }
 
     // if prefer empty, select an empty cell from the final connection list
-    if (prefer_empty) FindEmptyCell(*disp_list, found_list);
+    if (prefer_empty) {
+      cPopulationCell* empty_cell = FindEmptyNeighbor(ctx, *disp_cell);
+      if (empty_cell != NULL) return *empty_cell;
+    }
 
     // if prefer empty is off, or there are no empty cells, use the whole connection list as possiblities
-    if (found_list.GetSize() == 0) {
-      found_list = *disp_list;
-      // if no hops were taken and ALLOW_PARENT is set, throw the parent cell into the hat for possible selection
-      if (hops == 0 && parent_ok) found_list.Push(&parent_cell);
-    }
+    for (int i = 0; i < disp_cell->GetNumNeighbors(); i++) found_list.PushRear(&disp_cell->GetNeighbor(i));
+    // if no hops were taken and ALLOW_PARENT is set, throw the parent cell into the hat for possible selection
+    if (hops == 0 && parent_ok) found_list.Push(&parent_cell);
   } else if (prefer_empty) {
-    FindEmptyCell(conn_list, found_list);
+    cPopulationCell* empty_cell = FindEmptyNeighbor(ctx, parent_cell);
+    if (empty_cell != NULL) return *empty_cell;
   }
 
   // If we have not found an empty organism, we must use the specified function
@@ -5438,7 +5565,7 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
         PositionMerit(parent_cell, found_list, parent_ok);
         break;
       case POSITION_OFFSPRING_RANDOM:
-        found_list.Append(conn_list);
+        for (int i = 0; i < parent_cell.GetNumNeighbors(); i++) found_list.PushRear(&parent_cell.GetNeighbor(i));
         if (parent_ok == true) found_list.Push(&parent_cell);
         break;
       case POSITION_OFFSPRING_NEIGHBORHOOD_ENERGY_USED:
@@ -5469,10 +5596,8 @@ void cPopulation::PositionAge(cPopulationCell & parent_cell,
   if (parent_ok == false) max_age = -1;
 
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
-
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  for (int i = 0; i < parent_cell.GetNumNeighbors(); i++) {
+    cPopulationCell* test_cell = &parent_cell.GetNeighbor(i);
     const int cur_age = test_cell->GetOrganism()->GetPhenotype().GetAge();
     if (cur_age > max_age) {
       max_age = cur_age;
@@ -5497,10 +5622,8 @@ void cPopulation::PositionMerit(cPopulationCell & parent_cell,
   if (parent_ok == false) max_ratio = -1;
 
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
-
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  for (int i = 0; i < parent_cell.GetNumNeighbors(); i++) {
+    cPopulationCell* test_cell = &parent_cell.GetNeighbor(i);
     const double cur_ratio = test_cell->GetOrganism()->CalcMeritRatio();
     if (cur_ratio > max_ratio) {
       max_ratio = cur_ratio;
@@ -5525,10 +5648,8 @@ void cPopulation::PositionEnergyUsed(cPopulationCell & parent_cell,
   if (parent_ok == false) max_energy_used = -1;
 
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
-
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  for (int i = 0; i < parent_cell.GetNumNeighbors(); i++) {
+    cPopulationCell* test_cell = &parent_cell.GetNeighbor(i);
     const int cur_energy_used = test_cell->GetOrganism()->GetPhenotype().GetTimeUsed();
     if (cur_energy_used > max_energy_used) {
       max_energy_used = cur_energy_used;
@@ -5673,10 +5794,10 @@ cPopulationCell& cPopulation::PositionDemeRandom(int deme_id, cPopulationCell& p
   // Look randomly within empty cells first, if requested
   if (m_world->GetConfig().PREFER_EMPTY.Get()) {
 
-    int num_empty_cells = UpdateEmptyCellIDArray(deme_id);
+    const int num_empty_cells = m_empty_cells.GetNumEmpty(deme_id);
     if (num_empty_cells > 0) {
       int out_pos = m_world->GetRandom().GetUInt(num_empty_cells);
-      return GetCell(empty_cell_id_array[out_pos]);
+      return GetCell(m_empty_cells.GetEmptyCell(deme_id, out_pos));
     }
   }
 
@@ -5693,49 +5814,9 @@ cPopulationCell& cPopulation::PositionDemeRandom(int deme_id, cPopulationCell& p
 
 int cPopulation::FindRandEmptyCell(cAvidaContext& ctx)
 {
-  int world_size = cell_array.GetSize();
-  // full world
-  if (num_organisms >= world_size) return -1;
-
-  Apto::Array<int>& cells = GetEmptyCellIDArray();
-  int cell_idx = ctx.GetRandom().GetUInt(world_size);
-  int cell_id = cells[cell_idx];
-  while (GetCell(cell_id).IsOccupied()) {
-    // no need to pop this cell off the array, just move it and don't check that far anymore
-    cells.Swap(cell_idx, --world_size);
-    // if ran out of cells to check (e.g. with birth chamber weirdness)
-    if (world_size == 1) return -1;
-    cell_idx = ctx.GetRandom().GetUInt(world_size);
-    cell_id = cells[cell_idx];
-  }
-  return cell_id;
-}
-
-// This function updates the list of empty cell ids in the population
-// and returns the number of empty cells found. Used by global PREFER_EMPTY
-// PositionOffspring() methods with demes (only).
-int cPopulation::UpdateEmptyCellIDArray(int deme_id)
-{
-  int num_empty_cells = 0;
-  // Note: empty_cell_id_array was resized to be large enough to hold
-  // all cells in the cPopulation when it was created. Using functions
-  // that resize it (like Push) will slow this code down considerably.
-  // Instead, we keep track of how much of this memory we are using.
-
-  // Look at all cells
-  if (deme_id == -1) {
-    for (int i=0; i<cell_array.GetSize(); i++) {
-      if (GetCell(i).IsOccupied() == false) empty_cell_id_array[num_empty_cells++] = i;
-    }
-  }
-  // Look at a specific deme
-  else {
-    cDeme& deme = deme_array[deme_id];
-    for (int i=0; i<deme.GetSize(); i++) {
-      if (GetCell(deme.GetCellID(i)).IsOccupied() == false) empty_cell_id_array[num_empty_cells++] = deme.GetCellID(i);
-    }
-  }
-  return num_empty_cells;
+  const int num_empty = m_empty_cells.GetNumEmpty();
+  if (num_empty == 0) return -1;
+  return m_empty_cells.GetEmptyCell(ctx.GetRandom().GetUInt(num_empty));
 }
 
 
@@ -5768,9 +5849,7 @@ void cPopulation::ProcessStep(cAvidaContext& ctx, double step_size, int cell_id)
   resource_count.Update(step_size);
 
   // These must be done even if there is only one deme.
-  for(int i = 0; i < GetNumDemes(); i++) {
-    GetDeme(i).Update(step_size);
-  }
+  AdvanceDemeResourceTime(step_size);
 
   cDeme & deme = GetDeme(GetCell(cell_id).GetDemeID());
   deme.IncTimeUsed(merit);
@@ -5814,7 +5893,7 @@ void cPopulation::ProcessStepSpeculative(cAvidaContext& ctx, double step_size, i
 
   // Deme specific
   if (GetNumDemes() > 1) {
-    for(int i = 0; i < GetNumDemes(); i++) GetDeme(i).Update(step_size);
+    AdvanceDemeResourceTime(step_size);
 
     cDeme& deme = GetDeme(GetCell(cell_id).GetDemeID());
     deme.IncTimeUsed(cur_org->GetPhenotype().GetMerit().GetDouble());
@@ -5831,6 +5910,26 @@ void cPopulation::ProcessStepSpeculative(cAvidaContext& ctx, double step_size, i
   resource_count.Update(step_size);
 }
 
+// Deme resource time is counted here in steps and only added to a deme's resources when the deme next uses them
+// (cDeme::SyncResourceTime), rather than advancing every deme after every instruction.
+void cPopulation::AdvanceDemeResourceTime(double step_size)
+{
+  if (step_size != m_deme_res_step_size) {
+    SyncDemeResourceTime();
+    m_deme_res_step_size = step_size;
+  }
+  m_deme_res_steps++;
+}
+
+void cPopulation::SyncDemeResourceTime()
+{
+  for (int i = 0; i < GetNumDemes(); i++) {
+    GetDeme(i).SyncResourceTime();
+    GetDeme(i).ClearResourceSteps();
+  }
+  m_deme_res_steps = 0;
+}
+
 // Loop through all the demes getting stats and doing calculations
 // which must be done on a deme by deme basis.
 void cPopulation::UpdateDemeStats(cAvidaContext& ctx) {
@@ -5888,6 +5987,50 @@ void cPopulation::UpdateDemeStats(cAvidaContext& ctx) {
 }
 
 
+// Organisms per cOrgStatTotals chunk.  Fixed so that the merge order, and so the rounding of the sums, does not depend
+// on the number of worker threads.
+static const int ORG_STATS_CHUNK_SIZE = 256;
+
+class cPopulation::cOrgStatsJob : public cWorkerPool::cJob
+{
+private:
+  const Apto::Array<cOrganism*, Apto::Smart>& m_orgs;
+  Apto::Array<cOrgStatTotals>& m_totals;
+  int m_num_tasks;
+  int m_num_reactions;
+  
+public:
+  cOrgStatsJob(const Apto::Array<cOrganism*, Apto::Smart>& orgs, Apto::Array<cOrgStatTotals>& totals, int num_tasks, int num_reactions)
+    : m_orgs(orgs), m_totals(totals), m_num_tasks(num_tasks), m_num_reactions(num_reactions) { ; }
+  
+  void Run(int item)
+  {
+    cOrgStatTotals& totals = m_totals[item];
+    totals.Reset(m_num_tasks, m_num_reactions);
+    const int end = Apto::Min((item + 1) * ORG_STATS_CHUNK_SIZE, m_orgs.GetSize());
+    for (int i = item * ORG_STATS_CHUNK_SIZE; i < end; i++) {
+      totals.AddOrganism(m_orgs[i]);
+      
+      // Increment the age of this organism.
+      m_orgs[i]->GetPhenotype().IncAge();
+    }
+  }
+};
+
+
+// Organism stat providers are fed by UpdateOrganismStats(), so it must run whenever a recorder reads one of them
+bool cPopulation::HasActiveOrgStatProvider() const
+{
+  Data::ManagerPtr manager = Data::Manager::Of(m_world->GetNewWorld());
+  for (int osp_idx = 0; osp_idx < m_org_stat_providers.GetSize(); osp_idx++) {
+    Data::ConstDataSetPtr provided = m_org_stat_providers[osp_idx]->Provides();
+    for (Data::ConstDataSetIterator it = provided->Begin(); it.Next();) {
+      if (manager->IsActive(*it.Get())) return true;
+    }
+  }
+  return false;
+}
+
 void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
 {
   // Loop through all the cells getting stats and doing calculations
@@ -5914,27 +6057,13 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
 
   for (int osp_idx = 0; osp_idx < m_org_stat_providers.GetSize(); osp_idx++) m_org_stat_providers[osp_idx]->UpdateReset();
 
-  // Counts...
-  int num_breed_true = 0;
-  int num_parasites = 0;
-  int num_no_birth = 0;
-  int num_multi_thread = 0;
-  int num_single_thread = 0;
-  int num_threads = 0;
-  int num_modified = 0;
-
-  // Maximums...
-  cMerit max_merit(0);
-  double max_fitness = 0;
-  int max_gestation_time = 0;
-  int max_genome_length = 0;
-
-  // Minimums...
-  cMerit min_merit(FLT_MAX);
-  double min_fitness = FLT_MAX;
-  int min_gestation_time = INT_MAX;
-  int min_genome_length = INT_MAX;
+  // Instruction counts from messages are kept by instruction set name; resolve each set once per update rather than
+  // once per organism.  Looking up a new name can add to the stats map, so cached entries are refreshed after each.
+  Apto::Array<const cInstSet*> is_keys;
+  Apto::Array<cString> is_names;
+  Apto::Array<Apto::Array<Apto::Stat::Accumulator<int> >*> is_counts;
 
+  // Work that touches shared state runs serially, ahead of the per-organism sums
   for (int i = 0; i < live_org_list.GetSize(); i++) {
     cOrganism* organism = live_org_list[i];
 
@@ -5942,84 +6071,19 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
       m_org_stat_providers[osp_idx]->HandleOrganism(organism);
     }
 
-    const cPhenotype& phenotype = organism->GetPhenotype();
-    const cMerit cur_merit = phenotype.GetMerit();
-    const double cur_fitness = phenotype.GetFitness();
-    const int cur_gestation_time = phenotype.GetGestationTime();
-    const int cur_genome_length = phenotype.GetGenomeLength();
-
-    Apto::Array<Apto::Stat::Accumulator<int> >& from_message_exec_counts = stats.InstFromMessageExeCountsForInstSet((const char*)organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue());
-    int upper_bound = from_message_exec_counts.GetSize();
-    if (upper_bound > phenotype.GetLastFromMessageInstCount().GetSize()) {
-      upper_bound = phenotype.GetLastFromMessageInstCount().GetSize();
-    }
-    for (int j = 0; j < upper_bound; j++) {
-      from_message_exec_counts[j].Add(organism->GetPhenotype().GetLastFromMessageInstCount()[j]);
-    }
-
-    stats.SumFitness().Add(cur_fitness);
-    stats.SumMerit().Add(cur_merit.GetDouble());
-    stats.SumGestation().Add(phenotype.GetGestationTime());
-    stats.SumCreatureAge().Add(phenotype.GetAge());
-    stats.SumGeneration().Add(phenotype.GetGeneration());
-    stats.SumNeutralMetric().Add(phenotype.GetNeutralMetric());
-    stats.SumLineageLabel().Add(organism->GetLineageLabel());
-    stats.SumCopyMutRate().Push(organism->MutationRates().GetCopyMutProb());
-    stats.SumLogCopyMutRate().Push(log(organism->MutationRates().GetCopyMutProb()));
-    stats.SumDivMutRate().Push(organism->MutationRates().GetDivMutProb() / organism->GetPhenotype().GetDivType());
-    stats.SumLogDivMutRate().Push(log(organism->MutationRates().GetDivMutProb() / organism->GetPhenotype().GetDivType()));
-    stats.SumCopySize().Add(phenotype.GetCopiedSize());
-    stats.SumExeSize().Add(phenotype.GetExecutedSize());
-
-    if (cur_merit > max_merit) max_merit = cur_merit;
-    if (cur_fitness > max_fitness) max_fitness = cur_fitness;
-    if (cur_gestation_time > max_gestation_time) max_gestation_time = cur_gestation_time;
-    if (cur_genome_length > max_genome_length) max_genome_length = cur_genome_length;
-
-    if (cur_merit < min_merit) min_merit = cur_merit;
-    if (cur_fitness < min_fitness) min_fitness = cur_fitness;
-    if (cur_gestation_time < min_gestation_time) min_gestation_time = cur_gestation_time;
-    if (cur_genome_length < min_genome_length) min_genome_length = cur_genome_length;
-
-    // Test what tasks this creatures has completed.
-    for (int j = 0; j < m_world->GetEnvironment().GetNumTasks(); j++) {
-      if (phenotype.GetCurTaskCount()[j] > 0) {
-        stats.AddCurTask(j);
-        stats.AddCurTaskQuality(j, phenotype.GetCurTaskQuality()[j]);
-      }
-
-      if (phenotype.GetLastTaskCount()[j] > 0) {
-        stats.AddLastTask(j);
-        stats.AddLastTaskQuality(j, phenotype.GetLastTaskQuality()[j]);
-        stats.IncTaskExeCount(j, phenotype.GetLastTaskCount()[j]);
-      }
-
-      if (phenotype.GetCurHostTaskCount()[j] > 0) {
-        stats.AddCurHostTask(j);
-      }
-
-      if (phenotype.GetLastHostTaskCount()[j] > 0) {
-        stats.AddLastHostTask(j);
-      }
-
-      if (phenotype.GetCurParasiteTaskCount()[j] > 0) {
-        stats.AddCurParasiteTask(j);
-      }
-
-      if (phenotype.GetLastParasiteTaskCount()[j] > 0) {
-        stats.AddLastParasiteTask(j);
-      }
-
-      if (phenotype.GetCurInternalTaskCount()[j] > 0) {
-        stats.AddCurInternalTask(j);
-        stats.AddCurInternalTaskQuality(j, phenotype.GetCurInternalTaskQuality()[j]);
-      }
-
-      if (phenotype.GetLastInternalTaskCount()[j] > 0) {
-        stats.AddLastInternalTask(j);
-        stats.AddLastInternalTaskQuality(j, phenotype.GetLastInternalTaskQuality()[j]);
-      }
+    const cInstSet* inst_set = &organism->GetHardware().GetInstSet();
+    int is_idx = 0;
+    while (is_idx < is_keys.GetSize() && is_keys[is_idx] != inst_set) is_idx++;
+    if (is_idx == is_keys.GetSize()) {
+      is_keys.Push(inst_set);
+      is_names.Push((const char*)organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue());
+      is_counts.Push(NULL);
+      for (int k = 0; k < is_keys.GetSize(); k++) is_counts[k] = &stats.InstFromMessageExeCountsForInstSet(is_names[k]);
     }
+    Apto::Array<Apto::Stat::Accumulator<int> >& from_message_exec_counts = *is_counts[is_idx];
+    const Apto::Array<int>& last_from_message_counts = organism->GetPhenotype().GetLastFromMessageInstCount();
+    const int upper_bound = Apto::Min(from_message_exec_counts.GetSize(), last_from_message_counts.GetSize());
+    for (int j = 0; j < upper_bound; j++) from_message_exec_counts[j].Add(last_from_message_counts[j]);
 
     if (stats.ShouldCollectEnvTestStats()) {
       Systematics::GroupPtr genotype = organism->SystematicsGroup("genotype");
@@ -6028,64 +6092,60 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
 
       for (int j = 0; j < m_world->GetEnvironment().GetNumTasks(); j++) if (test_task_counts[j] > 0) stats.AddTestTask(j);
     }
+  }
 
+  // Per-organism sums, a chunk of organisms per job item, merged in chunk order
+  const int num_chunks = Apto::Max((live_org_list.GetSize() + ORG_STATS_CHUNK_SIZE - 1) / ORG_STATS_CHUNK_SIZE, 1);
+  if (m_org_stat_totals.GetSize() < num_chunks) m_org_stat_totals.Resize(num_chunks);
+  cOrgStatsJob job(live_org_list, m_org_stat_totals, m_world->GetEnvironment().GetNumTasks(), m_world->GetEnvironment().GetNumReactions());
+  if (m_worker_pool && num_chunks > 1) m_worker_pool->Execute(job, num_chunks);
+  else for (int i = 0; i < num_chunks; i++) job.Run(i);
 
-    // Record what add bonuses this organism garnered for different reactions
-    for (int j = 0; j < m_world->GetEnvironment().GetNumReactions(); j++) {
-      if (phenotype.GetCurReactionCount()[j] > 0) {
-        stats.AddCurReaction(j);
-        stats.AddCurReactionAddReward(j, phenotype.GetCurReactionAddReward()[j]);
-      }
-
-      if (phenotype.GetLastReactionCount()[j] > 0) {
-        stats.AddLastReaction(j);
-        stats.IncReactionExeCount(j, phenotype.GetLastReactionCount()[j]);
-        stats.AddLastReactionAddReward(j, phenotype.GetLastReactionAddReward()[j]);
-      }
-    }
+  cOrgStatTotals& totals = m_org_stat_totals[0];
+  for (int i = 1; i < num_chunks; i++) totals.Merge(m_org_stat_totals[i]);
+  stats.AddOrgStatTotals(totals);
 
-    // Test what resource combinations this creature has sensed
-    for (int j = 0; j < stats.GetSenseSize(); j++) {
-      if (phenotype.GetLastSenseCount()[j] > 0) {
-        stats.AddLastSense(j);
-        stats.IncLastSenseExeCount(j, phenotype.GetLastSenseCount()[j]);
-      }
-    }
+  stats.SetBreedTrueCreatures(totals.num_breed_true);
+  stats.SetNumNoBirthCreatures(totals.num_no_birth);
+  stats.SetNumParasites(totals.num_parasites);
+  stats.SetNumSingleThreadCreatures(totals.num_single_thread);
+  stats.SetNumMultiThreadCreatures(totals.num_multi_thread);
+  stats.SetNumThreads(totals.num_threads);
+  stats.SetNumModified(totals.num_modified);
 
-    // Increment the counts for all qualities the organism has...
-    num_parasites += organism->GetNumParasites();
-    if (phenotype.ParentTrue()) num_breed_true++;
-    if (phenotype.GetNumDivides() == 0) num_no_birth++;
-    if (phenotype.IsMultiThread()) num_multi_thread++;
-    else num_single_thread++;
+  stats.SetMaxMerit(totals.max_merit.GetDouble());
+  stats.SetMaxFitness(totals.max_fitness);
+  stats.SetMaxGestationTime(totals.max_gestation_time);
+  stats.SetMaxGenomeLength(totals.max_genome_length);
 
-    if (phenotype.IsModified()) num_modified++;
+  stats.SetMinMerit(totals.min_merit.GetDouble());
+  stats.SetMinFitness(totals.min_fitness);
+  stats.SetMinGestationTime(totals.min_gestation_time);
+  stats.SetMinGenomeLength(totals.min_genome_length);
 
-    cHardwareBase& hardware = organism->GetHardware();
-    stats.SumMemSize().Add(hardware.GetMemory().GetSize());
-    num_threads += hardware.GetNumThreads();
+  resource_count.UpdateGlobalResources(ctx);
+}
 
-    // Increment the age of this organism.
-    organism->GetPhenotype().IncAge();
-  }
+// Aging, global resources, and the handful of averages read during the update itself (avida time, vitality, verbose
+// progress, generation triggered events); used in place of UpdateOrganismStats() when nothing will read the rest.
+void cPopulation::UpdateOrganismCoreStats(cAvidaContext& ctx)
+{
+  cStats& stats = m_world->GetStats();
 
-  stats.SetBreedTrueCreatures(num_breed_true);
-  stats.SetNumNoBirthCreatures(num_no_birth);
-  stats.SetNumParasites(num_parasites);
-  stats.SetNumSingleThreadCreatures(num_single_thread);
-  stats.SetNumMultiThreadCreatures(num_multi_thread);
-  stats.SetNumThreads(num_threads);
-  stats.SetNumModified(num_modified);
+  stats.SumFitness().Clear();
+  stats.SumMerit().Clear();
+  stats.SumCreatureAge().Clear();
+  stats.SumGeneration().Clear();
 
-  stats.SetMaxMerit(max_merit.GetDouble());
-  stats.SetMaxFitness(max_fitness);
-  stats.SetMaxGestationTime(max_gestation_time);
-  stats.SetMaxGenomeLength(max_genome_length);
+  for (int i = 0; i < live_org_list.GetSize(); i++) {
+    cPhenotype& phenotype = live_org_list[i]->GetPhenotype();
+    stats.SumFitness().Add(phenotype.GetFitness());
+    stats.SumMerit().Add(phenotype.GetMerit().GetDouble());
+    stats.SumCreatureAge().Add(phenotype.GetAge());
+    stats.SumGeneration().Add(phenotype.GetGeneration());
 
-  stats.SetMinMerit(min_merit.GetDouble());
-  stats.SetMinFitness(min_fitness);
-  stats.SetMinGestationTime(min_gestation_time);
-  stats.SetMinGenomeLength(min_genome_length);
+    phenotype.IncAge();
+  }
 
   resource_count.UpdateGlobalResources(ctx);
 }
@@ -6283,19 +6343,25 @@ void cPopulation::ProcessPreUpdate()
 
 void cPopulation::ProcessPostUpdate(cAvidaContext& ctx)
 {
+  ReplicatePendingDemes(ctx);
   ProcessUpdateCellActions(ctx);
 
   cStats& stats = m_world->GetStats();
 
   stats.SetNumCreatures(GetNumOrganisms());
 
+  SyncDemeResourceTime();
   UpdateDemeStats(ctx);
-  UpdateOrganismStats(ctx);
-  if (m_world->GetConfig().PRED_PREY_SWITCH.Get() == -2 || m_world->GetConfig().PRED_PREY_SWITCH.Get() > -1) {
-    UpdateFTOrgStats(ctx);
-  }
-  if (m_world->GetConfig().MATING_TYPES.Get()) {
-    UpdateMaleFemaleOrgStats(ctx);
+  if (stats.ShouldCollectOrgStats()) {
+    UpdateOrganismStats(ctx);
+    if (m_world->GetConfig().PRED_PREY_SWITCH.Get() == -2 || m_world->GetConfig().PRED_PREY_SWITCH.Get() > -1) {
+      UpdateFTOrgStats(ctx);
+    }
+    if (m_world->GetConfig().MATING_TYPES.Get()) {
+      UpdateMaleFemaleOrgStats(ctx);
+    }
+  } else {
+    UpdateOrganismCoreStats(ctx);
   }
 
   for (int i = 0; i < deme_array.GetSize(); i++) deme_array[i].ProcessUpdate(ctx);
@@ -7402,6 +7468,24 @@ void cPopulation::BuildTimeSlicer()
       m_scheduler = new Apto::Scheduler::ProbabilisticIntegrated(cell_array.GetSize(), rng);
     }
       break;
+    case SLICE_PROB_MERIT_BATCH:
+    {
+      Apto::SmartPtr<Apto::Random> rng(new Apto::RNG::AvidaRNG(m_world->GetRandom().GetInt(0x7FFFFFFF)));
+      m_scheduler = new cBatchProbSchedule(cell_array.GetSize(), rng, m_world->GetConfig().SLICE_BATCH_SIZE.Get());
+    }
+      break;
+    case SLICE_DEME_BLOCK:
+    {
+      Apto::SmartPtr<Apto::Random> rng(new Apto::RNG::AvidaRNG(m_world->GetRandom().GetInt(0x7FFFFFFF)));
+      m_scheduler = new cDemeBlockSchedule(cell_array.GetSize(), deme_array.GetSize(), rng, m_world->GetConfig().SLICE_BATCH_SIZE.Get());
+    }
+      break;
+    case SLICE_PROB_MERIT_ORDERED:
+    {
+      Apto::SmartPtr<Apto::Random> rng(new Apto::RNG::AvidaRNG(m_world->GetRandom().GetInt(0x7FFFFFFF)));
+      m_scheduler = new cBatchProbSchedule(cell_array.GetSize(), rng, m_world->GetConfig().SLICE_BATCH_SIZE.Get(), true);
+    }
+      break;
     default:
       cout << "error: requested time slicer not found." << endl;
       m_world->GetDriver().Abort(Avida::INVALID_CONFIG);
@@ -7410,16 +7494,22 @@ void cPopulation::BuildTimeSlicer()
 }
 
 
-void cPopulation::FindEmptyCell(tList<cPopulationCell> & cell_list,
-                                tList<cPopulationCell> & found_list)
+// Picks one of the empty neighbors of cell at random, or returns NULL if they are all occupied.  The occupancy
+// bitmap is counted first so that the choice needs no list of candidates.
+cPopulationCell* cPopulation::FindEmptyNeighbor(cAvidaContext& ctx, const cPopulationCell& cell)
 {
-  tListIterator<cPopulationCell> cell_it(cell_list);
-  cPopulationCell * test_cell;
+  int num_empty = 0;
+  for (int i = 0; i < cell.GetNumNeighbors(); i++) {
+    if (m_empty_cells.IsEmpty(cell.GetNeighborID(i))) num_empty++;
+  }
+  if (num_empty == 0) return NULL;
 
-  while ( (test_cell = cell_it.Next()) != NULL) {
-    // If this cell is empty, add it to the list...
-    if (test_cell->IsOccupied() == false) found_list.Push(test_cell);
+  int choice = ctx.GetRandom().GetUInt(num_empty);
+  for (int i = 0; i < cell.GetNumNeighbors(); i++) {
+    const int neighbor_id = cell.GetNeighborID(i);
+    if (m_empty_cells.IsEmpty(neighbor_id) && choice-- == 0) return &cell_array[neighbor_id];
   }
+  return NULL;
 }
 
 
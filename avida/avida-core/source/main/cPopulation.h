@@ -27,7 +27,10 @@
 
 #include "cBirthChamber.h"
 #include "cDeme.h"
+#include "cEmptyCellIndex.h"
+#include "cOccupancyIndex.h"
 #include "cOrgInterface.h"
+#include "cOrgStatTotals.h"
 #include "cPopulationInterface.h"
 #include "cResourceCount.h"
 #include "cString.h"
@@ -44,6 +47,7 @@ class cEnvironment;
 class cLineage;
 class cOrganism;
 class cPopulationCell;
+class cWorkerPool;
 
 using namespace Avida;
 
@@ -66,9 +70,17 @@ private:
   // Components...
   cWorld* m_world;
   Apto::PriorityScheduler* m_scheduler;                // Handles allocation of CPU cycles
+  cWorkerPool* m_worker_pool;               // Threads for splitting up work within an update (NULL if single threaded)
   Apto::Array<cPopulationCell> cell_array;  // Local cells composing the population
-  Apto::Array<int> empty_cell_id_array;     // Used for PREFER_EMPTY birth methods
+  bool m_well_mixed;                        // Cells have no neighbors and no spatial occupancy is tracked
+  Apto::Array<int> m_neighbor_table;        // Neighbor ids of every cell, a row per cell in cell order
+  Apto::Array<int> empty_cell_id_array;     // Scratch list used when picking empty demes
+  cOccupancyIndex m_occupancy;              // Organism and avatar counts by region, for sensor look-ahead
+  cEmptyCellIndex m_empty_cells;            // Empty cells of the world and of each deme, for offspring placement
   cResourceCount resource_count;       // Global resources available
+  int m_deme_res_steps;                // Steps executed since deme resources were last all brought up to date
+  double m_deme_res_step_size;         // Resource time per step, for m_deme_res_steps
+  Apto::Array<int> m_pending_deme_repro;  // Demes marked for implicit replication at the end of the update
   cBirthChamber birth_chamber;         // Global birth chamber.
   //Keeps track of which organisms are in which group.
   Apto::Map<int, Apto::Array<cOrganism*, Apto::Smart> > m_group_list;
@@ -81,6 +93,8 @@ private:
   Apto::Array<cOrganism*, Apto::Smart> live_org_list;
 
   Apto::Array<cPopulationOrgStatProviderPtr> m_org_stat_providers;
+  Apto::Array<cOrgStatTotals> m_org_stat_totals;    // Per-chunk partial sums for UpdateOrganismStats()
+  class cOrgStatsJob;
 
 
   Apto::Array<pair<int,int>, Apto::Smart>* sleep_log;
@@ -149,6 +163,7 @@ public:
   // cPopulation
 
   void AttachOrgStatProvider(cPopulationOrgStatProviderPtr provider) { m_org_stat_providers.Push(provider); }
+  bool HasActiveOrgStatProvider() const;
 
   void ResizeCellGrid(int x, int y);
 
@@ -224,6 +239,7 @@ public:
   void AddDemePred(cString type, int times);
 
   void CheckImplicitDemeRepro(cDeme& deme, cAvidaContext& ctx);
+  void ReplicatePendingDemes(cAvidaContext& ctx);
 
   // Deme-related stats methods
   void PrintDemeAllStats(cAvidaContext& ctx);
@@ -301,12 +317,19 @@ public:
   int GetNumDemes() const { return deme_array.GetSize(); }
   cDeme& GetDeme(int i) { return deme_array[i]; }
 
+  void ConnectCells(cPopulationCell& cell, cPopulationCell& neighbor, bool face);
   cPopulationCell& GetCell(int in_num) { assert(in_num >=0); assert(in_num < cell_array.GetSize()); return cell_array[in_num]; }
+  bool IsWellMixed() const { return m_well_mixed; }
+  const cOccupancyIndex* GetOccupancyIndex() const { return m_well_mixed ? NULL : &m_occupancy; }
+  void UpdateCellOccupancy(int cell_id);
   const Apto::Array<double>& GetResources(cAvidaContext& ctx) const { return resource_count.GetResources(ctx); }
   const Apto::Array<double>& GetCellResources(int cell_id, cAvidaContext& ctx) const { return resource_count.GetCellResources(cell_id, ctx); }
   const Apto::Array<double>& GetFrozenResources(cAvidaContext& ctx, int cell_id) const { return resource_count.GetFrozenResources(ctx, cell_id); }
   double GetFrozenCellResVal(cAvidaContext& ctx, int cell_id, int res_id) const { return resource_count.GetFrozenCellResVal(ctx, cell_id, res_id); }
   double GetCellResVal(cAvidaContext& ctx, int cell_id, int res_id) const { return resource_count.GetCellResVal(ctx, cell_id, res_id); }
+  int GetDemeResourceSteps() const { return m_deme_res_steps; }
+  double GetDemeResourceStepSize() const { return m_deme_res_step_size; }
+  void SyncDemeResourceTime();
   const Apto::Array<double>& GetDemeResources(int deme_id, cAvidaContext& ctx) { return GetDeme(deme_id).GetDemeResourceCount().GetResources(ctx); }
   const Apto::Array<double>& GetDemeCellResources(int deme_id, int cell_id, cAvidaContext& ctx) { return GetDeme(deme_id).GetDemeResourceCount().GetCellResources( GetDeme(deme_id).GetRelativeCellID(cell_id), ctx ); }
   void TriggerDoUpdates(cAvidaContext& ctx) { resource_count.UpdateResources(ctx); }
@@ -330,6 +353,7 @@ public:
   void SetResource(cAvidaContext& ctx, const cString res_name, double new_level);
   double GetResource(cAvidaContext& ctx, int id) const { return resource_count.Get(ctx, id); }
   cResourceCount& GetResourceCount() { return resource_count; }
+  cWorkerPool* GetWorkerPool() { return m_worker_pool; }
   void SetResourceInflow(const cString res_name, double new_level);
   void SetResourceOutflow(const cString res_name, double new_level);
 
@@ -452,6 +476,8 @@ private:
   void SetupCellGrid();
   void ClearCellGrid();
   void BuildTimeSlicer(); // Build the schedule object
+  void BuildNeighborTable();
+  void AssignNeighborRows();
 
   // Methods to place offspring in the population.
   cPopulationCell& PositionOffspring(cPopulationCell& parent_cell, cAvidaContext& ctx, bool parent_ok = true);
@@ -460,14 +486,15 @@ private:
   void PositionEnergyUsed(cPopulationCell & parent_cell, tList<cPopulationCell>& found_list, bool parent_ok);
   cPopulationCell& PositionDemeMigration(cPopulationCell& parent_cell, bool parent_ok = true);
   cPopulationCell& PositionDemeRandom(int deme_id, cPopulationCell& parent_cell, bool parent_ok = true);
-  int UpdateEmptyCellIDArray(int deme_id = -1);
-  Apto::Array<int>& GetEmptyCellIDArray() { return empty_cell_id_array; }
-  void FindEmptyCell(tList<cPopulationCell>& cell_list, tList<cPopulationCell>& found_list);
+  cPopulationCell* FindEmptyNeighbor(cAvidaContext& ctx, const cPopulationCell& cell);
   int FindRandEmptyCell(cAvidaContext& ctx);
 
+  void AdvanceDemeResourceTime(double step_size);
+
   // Update statistics collecting...
   void UpdateDemeStats(cAvidaContext& ctx);
   void UpdateOrganismStats(cAvidaContext& ctx);
+  void UpdateOrganismCoreStats(cAvidaContext& ctx);
   void UpdateFTOrgStats(cAvidaContext& ctx);
   void UpdateMaleFemaleOrgStats(cAvidaContext& ctx);
 
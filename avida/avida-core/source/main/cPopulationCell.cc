@@ -41,6 +41,10 @@ cPopulationCell::cPopulationCell(const cPopulationCell& in_cell)
 : m_world(in_cell.m_world)
 , m_organism(in_cell.m_organism)
 , m_hardware(in_cell.m_hardware)
+, m_cells(in_cell.m_cells)
+, m_neighbors(in_cell.m_neighbors)
+, m_num_neighbors(in_cell.m_num_neighbors)
+, m_facing(in_cell.m_facing)
 , m_inputs(in_cell.m_inputs)
 , m_cell_id(in_cell.m_cell_id)
 , m_deme_id(in_cell.m_deme_id)
@@ -71,6 +75,10 @@ void cPopulationCell::operator=(const cPopulationCell& in_cell)
 		m_world = in_cell.m_world;
 		m_organism = in_cell.m_organism;
 		m_hardware = in_cell.m_hardware;
+		m_cells = in_cell.m_cells;
+		m_neighbors = in_cell.m_neighbors;
+		m_num_neighbors = in_cell.m_num_neighbors;
+		m_facing = in_cell.m_facing;
 		m_inputs = in_cell.m_inputs;
 		m_cell_id = in_cell.m_cell_id;
 		m_deme_id = in_cell.m_deme_id;
@@ -128,18 +136,42 @@ void cPopulationCell::Rotate(cPopulationCell& new_facing)
     UnsetMigrant(); //@AWC -- unset the migrant flag for the next time this cell is used
     return;
   }
+  if (m_num_neighbors == 0) return;
 	
 #ifdef DEBUG
   int scan_count = 0;
 #endif
-  while (m_connections.GetFirst() != &new_facing) {
-    m_connections.CircNext();
+  while (&GetCellFaced() != &new_facing) {
+    RotateNext();
 #ifdef DEBUG
-    assert(++scan_count < m_connections.GetSize());
+    assert(++scan_count < m_num_neighbors);
 #endif
   }
 }
 
+bool cPopulationCell::IsConnectedTo(const cPopulationCell& cell) const
+{
+  for (int i = 0; i < m_num_neighbors; i++) if (&m_cells[m_neighbors[i]] == &cell) return true;
+  return false;
+}
+
+// Removes the first connection to cell, looking from the cell faced onward.  If that is the cell faced, the
+// following neighbor becomes the one faced.
+void cPopulationCell::RemoveConnection(const cPopulationCell& cell)
+{
+  for (int i = 0; i < m_num_neighbors; i++) {
+    int pos = m_facing + i;
+    if (pos >= m_num_neighbors) pos -= m_num_neighbors;
+    if (&m_cells[m_neighbors[pos]] != &cell) continue;
+    
+    for (int j = pos + 1; j < m_num_neighbors; j++) m_neighbors[j - 1] = m_neighbors[j];
+    m_num_neighbors--;
+    if (pos < m_facing) m_facing--;
+    if (m_facing >= m_num_neighbors) m_facing = 0;
+    return;
+  }
+}
+
 /*! This method recursively builds a set of cells that neighbor this cell, out to 
  the given depth.  The set must be passed in by-reference, as calls to this method 
  must share a common set of already-visited cells.
@@ -148,11 +180,9 @@ void cPopulationCell::GetNeighboringCells(std::set<cPopulationCell*>& cell_set,
 	typedef std::set<cPopulationCell*> cell_set_t;
   
   // For each cell in our connection list...
-  tConstListIterator<cPopulationCell> i(m_connections);
-  while(!i.AtEnd()) {
+  for (int i = 0; i < m_num_neighbors; i++) {
 		// store the cell pointer, and check to see if we've already visited that cell...
-    cPopulationCell* cell = i.Next();
-		assert(cell != 0); // cells should never be null.
+    cPopulationCell* cell = &GetNeighbor(i);
 		std::pair<cell_set_t::iterator, bool> ins = cell_set.insert(cell);
 		// and if so, recurse to it...
 		if(ins.second && (depth > 1)) {
@@ -176,13 +206,11 @@ void cPopulationCell::GetOccupiedNeighboringCells(std::set<cPopulationCell*>& oc
 
 void cPopulationCell::GetOccupiedNeighboringCells(Apto::Array<cPopulationCell*>& occupied_cells) const
 {
-  occupied_cells.Resize(m_connections.GetSize());
+  occupied_cells.Resize(m_num_neighbors);
   int occupied_count = 0;
 
-  tLWConstListIterator<cPopulationCell> i(m_connections);
-  while(!i.AtEnd()) {
-    cPopulationCell* cell = i.Next();
-		assert(cell); // cells should never be null.
+  for (int i = 0; i < m_num_neighbors; i++) {
+    cPopulationCell* cell = &GetNeighbor(i);
     if (cell->IsOccupied()) occupied_cells[occupied_count++] = cell;
   }
   
@@ -207,7 +235,8 @@ void cPopulationCell::GetOccupiedNeighboringCells(Apto::Array<cPopulationCell*>&
 int cPopulationCell::GetFacing()
 {
   // This whole function is a hack.
-	cPopulationCell* faced = ConnectionList().GetFirst();
+  if (m_num_neighbors == 0) return 0;
+	cPopulationCell* faced = &GetCellFaced();
 	
 	int x=0,y=0,lr=0,du=0;
 	faced->GetPosition(x,y);
@@ -278,6 +307,7 @@ void cPopulationCell::InsertOrganism(cOrganism* new_org, cAvidaContext& ctx)
   if(m_organism->GetOrgInterface().GetPrevSeenCellID() == -1) {
     m_organism->GetOrgInterface().SetPrevSeenCellID(m_cell_id);
   }
+  m_world->GetPopulation().UpdateCellOccupancy(m_cell_id);
   
   if(m_world->GetConfig().ENERGY_ENABLED.Get() == 1 && m_world->GetConfig().FRAC_ENERGY_TRANSFER.Get() > 0.0) {
     // uptake all the cells energy
@@ -303,6 +333,7 @@ cOrganism * cPopulationCell::RemoveOrganism(cAvidaContext& ctx)
   }
   m_organism = NULL;
   m_hardware = NULL;
+  m_world->GetPopulation().UpdateCellOccupancy(m_cell_id);
   return out_organism;
 }
 
@@ -336,6 +367,7 @@ void cPopulationCell::AddPredAV(cAvidaContext& ctx, cOrganism* org)
   m_av_pred.Swap(loc, m_av_pred.GetSize() - 1);
   exist_org->SetAVInIndex(m_av_pred.GetSize() - 1);
   org->SetAVInIndex(loc);
+  m_world->GetPopulation().UpdateCellOccupancy(m_cell_id);
 }
 
 // Adds an organism to the cell's prey (output) avatars, then keeps the list mixed by swapping the new avatar into a random position in the array
@@ -348,6 +380,7 @@ void cPopulationCell::AddPreyAV(cAvidaContext& ctx, cOrganism* org)
   m_av_prey.Swap(loc, m_av_prey.GetSize() - 1);
   exist_org->SetAVOutIndex(m_av_prey.GetSize() - 1);
   org->SetAVOutIndex(loc);
+  m_world->GetPopulation().UpdateCellOccupancy(m_cell_id);
 }
 
 // Removes the organism from the cell's input avatars (predator)
@@ -360,6 +393,7 @@ void cPopulationCell::RemovePredAV(cOrganism* org)
   exist_org->SetAVInIndex(org->GetAVInIndex());
   m_av_pred.Swap(org->GetAVInIndex(), last);
   m_av_pred.Pop();
+  m_world->GetPopulation().UpdateCellOccupancy(m_cell_id);
 }
 
 // Removes the organism from the cell's output avatars (prey)
@@ -372,6 +406,7 @@ void cPopulationCell::RemovePreyAV(cOrganism* org)
   exist_org->SetAVOutIndex(org->GetAVOutIndex());
   m_av_prey.Swap(org->GetAVOutIndex(), last);
   m_av_prey.Pop();
+  m_world->GetPopulation().UpdateCellOccupancy(m_cell_id);
 }
 
 // Returns whether a cell has an output AV that the org will be able to receive messages from.
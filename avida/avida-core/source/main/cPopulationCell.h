@@ -52,7 +52,11 @@ private:
   cOrganism* m_organism;                    // The occupent of this cell.
   cHardwareBase* m_hardware;
 
-  tList<cPopulationCell> m_connections;  // A list of neighboring cells.
+  tList<cPopulationCell> m_connections;  // Neighbors as added by the topology builders; moved to the neighbor table
+  cPopulationCell* m_cells;              // Cell array the neighbor ids index into
+  int* m_neighbors;                      // This cell's row of the population's neighbor table (cell ids)
+  int m_num_neighbors;
+  int m_facing;                          // Position in m_neighbors of the cell faced
   cMutationRates* m_mut_rates;           // Mutation rates at this cell.
   Apto::Array<int> m_inputs;                 // Environmental Inputs...
 
@@ -86,7 +90,8 @@ private:
 public:
   typedef std::set<cPopulationCell*> neighborhood_type; //!< Type for cell neighborhoods.
 
-  cPopulationCell() : m_world(NULL), m_organism(NULL), m_hardware(NULL), m_mut_rates(NULL), m_migrant(false), m_can_input(false), m_can_output(false), m_hgt(0) { ; }
+  cPopulationCell() : m_world(NULL), m_organism(NULL), m_hardware(NULL), m_cells(NULL), m_neighbors(NULL), m_num_neighbors(0), m_facing(0)
+    , m_mut_rates(NULL), m_migrant(false), m_can_input(false), m_can_output(false), m_hgt(0) { ; }
   cPopulationCell(const cPopulationCell& in_cell);
   ~cPopulationCell() { delete m_mut_rates; delete m_hgt; }
 
@@ -103,13 +108,29 @@ public:
 
   inline cOrganism* GetOrganism() const { return m_organism; }
   inline cHardwareBase* GetHardware() const { return m_hardware; }
+  //! Connections made while building the topology, before cPopulation moves them into its neighbor table.
   inline tList<cPopulationCell>& ConnectionList() { return m_connections; }
+  
+  // Neighbors are numbered from the one faced (0) onward, so rotating changes which cell each index names.
+  inline int GetNumNeighbors() const { return m_num_neighbors; }
+  inline int GetNeighborID(int i) const
+  {
+    assert(i >= 0 && i < m_num_neighbors);
+    int pos = m_facing + i;
+    if (pos >= m_num_neighbors) pos -= m_num_neighbors;
+    return m_neighbors[pos];
+  }
+  inline cPopulationCell& GetNeighbor(int i) const { return m_cells[GetNeighborID(i)]; }
+  inline void RotateNext() { if (m_num_neighbors > 0 && ++m_facing == m_num_neighbors) m_facing = 0; }
+  inline void RotatePrev() { if (m_num_neighbors > 0 && --m_facing < 0) m_facing = m_num_neighbors - 1; }
+  bool IsConnectedTo(const cPopulationCell& cell) const;
+  void RemoveConnection(const cPopulationCell& cell);
   //! Recursively build a set of cells that neighbor this one, out to the given depth.
   void GetNeighboringCells(std::set<cPopulationCell*>& cell_set, int depth) const;
   //! Recursively build a set of occupied cells that neighbor this one, out to the given depth.
   void GetOccupiedNeighboringCells(std::set<cPopulationCell*>& occupied_cell_set, int depth) const;
   void GetOccupiedNeighboringCells(Apto::Array<cPopulationCell*>& occupied_cells) const;
-  inline cPopulationCell& GetCellFaced() { return *(m_connections.GetFirst()); }
+  inline cPopulationCell& GetCellFaced() const { return m_cells[m_neighbors[m_facing]]; }
   int GetFacing();  // Returns the facing of this cell.
   int GetFacedDir(); // Returns the human interpretable facing of this org.
   inline void GetPosition(int& x, int& y) const { x = m_x; y = m_y; } // Retrieves the position (x,y) coordinates of this cell.
@@ -102,6 +102,7 @@ int cPopulationInterface::GetCellYPosition()
 }
 
 cPopulationCell* cPopulationInterface::GetCellFaced() {
+	if (GetCell()->GetNumNeighbors() == 0) return NULL;
 	return &GetCell()->GetCellFaced();
 }
 
@@ -135,19 +136,27 @@ int cPopulationInterface::GetCellDataForagerType() {
 }
 
 int cPopulationInterface::GetFacedCellData() {
-  return m_world->GetPopulation().GetCell(m_cell_id).GetCellFaced().GetCellData();
+  cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
+  if (cell.GetNumNeighbors() == 0) return -1;
+  return cell.GetCellFaced().GetCellData();
 }
 
 int cPopulationInterface::GetFacedCellDataOrgID() {
-  return m_world->GetPopulation().GetCell(m_cell_id).GetCellFaced().GetCellDataOrgID();
+  cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
+  if (cell.GetNumNeighbors() == 0) return -1;
+  return cell.GetCellFaced().GetCellDataOrgID();
 }
 
 int cPopulationInterface::GetFacedCellDataUpdate() {
-  return m_world->GetPopulation().GetCell(m_cell_id).GetCellFaced().GetCellDataUpdate();
+  cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
+  if (cell.GetNumNeighbors() == 0) return -1;
+  return cell.GetCellFaced().GetCellDataUpdate();
 }
 
 int cPopulationInterface::GetFacedCellDataTerritory() {
-  return m_world->GetPopulation().GetCell(m_cell_id).GetCellFaced().GetCellDataTerritory();
+  cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
+  if (cell.GetNumNeighbors() == 0) return -1;
+  return cell.GetCellFaced().GetCellDataTerritory();
 }
 
 void cPopulationInterface::SetCellData(const int newData) {
@@ -248,12 +257,14 @@ cOrganism* cPopulationInterface::GetNeighbor()
   cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
   assert(cell.IsOccupied());
 
-  return cell.ConnectionList().GetFirst()->GetOrganism();
+  if (cell.GetNumNeighbors() == 0) return NULL;
+  return cell.GetCellFaced().GetOrganism();
 }
 
 bool cPopulationInterface::IsNeighborCellOccupied() {
   cPopulationCell & cell = m_world->GetPopulation().GetCell(m_cell_id);
-  return cell.ConnectionList().GetFirst()->IsOccupied();
+  if (cell.GetNumNeighbors() == 0) return false;
+  return cell.GetCellFaced().IsOccupied();
 }
 
 int cPopulationInterface::GetNumNeighbors()
@@ -261,7 +272,7 @@ int cPopulationInterface::GetNumNeighbors()
   cPopulationCell & cell = m_world->GetPopulation().GetCell(m_cell_id);
   assert(cell.IsOccupied());
 
-  return cell.ConnectionList().GetSize();
+  return cell.GetNumNeighbors();
 }
 
 void cPopulationInterface::GetNeighborhoodCellIDs(Apto::Array<int>& list)
@@ -269,10 +280,8 @@ void cPopulationInterface::GetNeighborhoodCellIDs(Apto::Array<int>& list)
   cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
   assert(cell.IsOccupied());
 
-  list.Resize(cell.ConnectionList().GetSize());
-  tConstListIterator<cPopulationCell> it(cell.ConnectionList());
-  int i = 0;
-  while (it.Next() != NULL) list[i++] = it.Get()->GetID();
+  list.Resize(cell.GetNumNeighbors());
+  for (int i = 0; i < cell.GetNumNeighbors(); i++) list[i] = cell.GetNeighbor(i).GetID();
 }
 
 void cPopulationInterface::GetAVNeighborhoodCellIDs(Apto::Array<int>& list, int av_num)
@@ -280,10 +289,8 @@ void cPopulationInterface::GetAVNeighborhoodCellIDs(Apto::Array<int>& list, int
   cPopulationCell& cell = m_world->GetPopulation().GetCell(m_avatars[av_num].av_cell_id);
   assert(cell.HasAV());
 
-  list.Resize(cell.ConnectionList().GetSize());
-  tConstListIterator<cPopulationCell> it(cell.ConnectionList());
-  int i = 0;
-  while (it.Next() != NULL) list[i++] = it.Get()->GetID();
+  list.Resize(cell.GetNumNeighbors());
+  for (int i = 0; i < cell.GetNumNeighbors(); i++) list[i] = cell.GetNeighbor(i).GetID();
 }
 
 int cPopulationInterface::GetFacing()
@@ -295,8 +302,9 @@ int cPopulationInterface::GetFacing()
 
 int cPopulationInterface::GetFacedCellID()
 {
-	cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id).GetCellFaced();
-	return cell.GetID();
+	cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
+	if (cell.GetNumNeighbors() == 0) return -1;
+	return cell.GetCellFaced().GetID();
 }
 
 int cPopulationInterface::GetFacedDir()
@@ -308,7 +316,8 @@ int cPopulationInterface::GetFacedDir()
 
 int cPopulationInterface::GetNeighborCellContents() {
   cPopulationCell & cell = m_world->GetPopulation().GetCell(m_cell_id);
-  return cell.ConnectionList().GetFirst()->GetCellData();
+  if (cell.GetNumNeighbors() == 0) return 0;
+  return cell.GetCellFaced().GetCellData();
 }
 
 void cPopulationInterface::Rotate(cAvidaContext& ctx, int direction)
@@ -321,8 +330,8 @@ void cPopulationInterface::Rotate(cAvidaContext& ctx, int direction)
     else RotateAV(ctx, -1);
   }
   else {
-    if (direction >= 0) cell.ConnectionList().CircNext();
-    else cell.ConnectionList().CircPrev();
+    if (direction >= 0) cell.RotateNext();
+    else cell.RotatePrev();
   }
 }
 
@@ -355,11 +364,18 @@ double cPopulationInterface::GetResourceVal(cAvidaContext& ctx, int res_id)
 
 const Apto::Array<double>& cPopulationInterface::GetFacedCellResources(cAvidaContext& ctx)
 {
+  // A cell without neighbors faces nothing, so there are no resources ahead of it.
+  if (GetCell()->GetNumNeighbors() == 0) {
+    m_no_faced_resources.Resize(m_world->GetPopulation().GetCellResources(m_cell_id, ctx).GetSize());
+    m_no_faced_resources.SetAll(0.0);
+    return m_no_faced_resources;
+  }
   return m_world->GetPopulation().GetCellResources(GetCell()->GetCellFaced().GetID(), ctx);
 }
 
 double cPopulationInterface::GetFacedResourceVal(cAvidaContext& ctx, int res_id)
 {
+  if (GetCell()->GetNumNeighbors() == 0) return 0.0;
   return m_world->GetPopulation().GetCellResVal(ctx, GetCell()->GetCellFaced().GetID(), res_id);
 }
 
@@ -484,11 +500,11 @@ int cPopulationInterface::ReceiveValue()
   cPopulationCell & cell = m_world->GetPopulation().GetCell(m_cell_id);
   assert(cell.IsOccupied());
 
-  const int num_neighbors = cell.ConnectionList().GetSize();
+  const int num_neighbors = cell.GetNumNeighbors();
   for (int i = 0; i < num_neighbors; i++) {
-    cell.ConnectionList().CircNext();
+    cell.RotateNext();
 
-    cOrganism* cur_neighbor = cell.ConnectionList().GetFirst()->GetOrganism();
+    cOrganism* cur_neighbor = cell.GetCellFaced().GetOrganism();
     if (cur_neighbor == NULL || cur_neighbor->GetSentActive() == false) {
       continue;
     }
@@ -605,7 +621,8 @@ bool cPopulationInterface::SendMessage(cOrgMessage& msg) {
     }
     return message_sent;
   } else {
-    cPopulationCell* rcell = cell.ConnectionList().GetFirst();
+    if (cell.GetNumNeighbors() == 0) return false;
+    cPopulationCell* rcell = &cell.GetCellFaced();
     assert(rcell != 0); // Cells should never be null.
     return SendMessage(msg, *rcell);
   }
@@ -662,8 +679,8 @@ bool cPopulationInterface::BcastAlarm(int jump_label, int bcast_range) {
       }
     }
   } else { // single hop messaging
-    for(int i = 0; i < scell.ConnectionList().GetSize(); i++) {
-      cPopulationCell* rcell = scell.ConnectionList().GetPos(i);
+    for(int i = 0; i < scell.GetNumNeighbors(); i++) {
+      cPopulationCell* rcell = &scell.GetNeighbor(i);
       assert(rcell != NULL); // Cells should never be null.
 
       // Fail if the cell we're facing is not occupied.
@@ -698,12 +715,12 @@ void cPopulationInterface::SendFlash() {
   cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
   assert(cell.IsOccupied());
 
-  for(int i=0; i<cell.ConnectionList().GetSize(); ++i) {
-    cPopulationCell* neighbor = cell.ConnectionList().GetFirst();
+  for(int i=0; i<cell.GetNumNeighbors(); ++i) {
+    cPopulationCell* neighbor = &cell.GetCellFaced();
     if(neighbor->IsOccupied()) {
       neighbor->GetOrganism()->ReceiveFlash();
     }
-    cell.ConnectionList().CircNext();
+    cell.RotateNext();
   }
 }
 
@@ -722,8 +739,8 @@ void cPopulationInterface::RotateToGreatestReputation()
 
 
 	// loop to find the max reputation
-	for(int i=0; i<cell.ConnectionList().GetSize(); ++i) {
-		const cPopulationCell* faced_cell = cell.ConnectionList().GetFirst();
+	for(int i=0; i<cell.GetNumNeighbors(); ++i) {
+		const cPopulationCell* faced_cell = &cell.GetCellFaced();
 		// cell->organism, if occupied, check reputation, etc.
 		if (IsNeighborCellOccupied()) {
 			cOrganism* cur_neighbor = faced_cell->GetOrganism();
@@ -739,7 +756,7 @@ void cPopulationInterface::RotateToGreatestReputation()
 		}
 
 		// check the next neighbor
-		cell.ConnectionList().CircNext();
+		cell.RotateNext();
 	}
 
 	// Pick an organism to donate to
@@ -748,8 +765,8 @@ void cPopulationInterface::RotateToGreatestReputation()
 		unsigned int rand_num = m_world->GetRandom().GetUInt(0, high_rep_orgs.size());
 		int high_org_id = high_rep_orgs[rand_num];
 
-		for(int i=0; i<cell.ConnectionList().GetSize(); ++i) {
-			const cPopulationCell* faced_cell = cell.ConnectionList().GetFirst();
+		for(int i=0; i<cell.GetNumNeighbors(); ++i) {
+			const cPopulationCell* faced_cell = &cell.GetCellFaced();
 
 			if (IsNeighborCellOccupied()) {
 
@@ -761,7 +778,7 @@ void cPopulationInterface::RotateToGreatestReputation()
 				}
 			}
 
-			cell.ConnectionList().CircNext();
+			cell.RotateNext();
 
 		}
 	}
@@ -778,8 +795,8 @@ void cPopulationInterface::RotateToGreatestReputationWithDifferentTag(int tag)
 	vector <int> high_rep_orgs;
 
 	// loop to find the max reputation
-	for(int i=0; i<cell.ConnectionList().GetSize(); ++i) {
-		const cPopulationCell* faced_cell = cell.ConnectionList().GetFirst();
+	for(int i=0; i<cell.GetNumNeighbors(); ++i) {
+		const cPopulationCell* faced_cell = &cell.GetCellFaced();
 		// cell->organism, if occupied, check reputation, etc.
 		if (IsNeighborCellOccupied()) {
 			cOrganism* cur_neighbor = faced_cell->GetOrganism();
@@ -795,7 +812,7 @@ void cPopulationInterface::RotateToGreatestReputationWithDifferentTag(int tag)
 		}
 
 		// check the next neighbor
-		cell.ConnectionList().CircNext();
+		cell.RotateNext();
 	}
 
 	// Pick an organism to donate to
@@ -804,8 +821,8 @@ void cPopulationInterface::RotateToGreatestReputationWithDifferentTag(int tag)
 		unsigned int rand_num = m_world->GetRandom().GetUInt(0, high_rep_orgs.size());
 		int high_org_id = high_rep_orgs[rand_num];
 
-		for(int i=0; i<cell.ConnectionList().GetSize(); ++i) {
-			const cPopulationCell* faced_cell = cell.ConnectionList().GetFirst();
+		for(int i=0; i<cell.GetNumNeighbors(); ++i) {
+			const cPopulationCell* faced_cell = &cell.GetCellFaced();
 
 			if (IsNeighborCellOccupied()) {
 
@@ -817,7 +834,7 @@ void cPopulationInterface::RotateToGreatestReputationWithDifferentTag(int tag)
 				}
 			}
 
-			cell.ConnectionList().CircNext();
+			cell.RotateNext();
 
 		}
 
@@ -837,8 +854,8 @@ void cPopulationInterface::RotateToGreatestReputationWithDifferentLineage(int li
 	vector <int> high_rep_orgs;
 
 	// loop to find the max reputation
-	for(int i=0; i<cell.ConnectionList().GetSize(); ++i) {
-		const cPopulationCell* faced_cell = cell.ConnectionList().GetFirst();
+	for(int i=0; i<cell.GetNumNeighbors(); ++i) {
+		const cPopulationCell* faced_cell = &cell.GetCellFaced();
 		// cell->organism, if occupied, check reputation, etc.
 		if (IsNeighborCellOccupied()) {
 			cOrganism* cur_neighbor = faced_cell->GetOrganism();
@@ -854,7 +871,7 @@ void cPopulationInterface::RotateToGreatestReputationWithDifferentLineage(int li
 		}
 
 		// check the next neighbor
-		cell.ConnectionList().CircNext();
+		cell.RotateNext();
 	}
 
 	// Pick an organism to donate to
@@ -863,8 +880,8 @@ void cPopulationInterface::RotateToGreatestReputationWithDifferentLineage(int li
 		unsigned int rand_num = m_world->GetRandom().GetUInt(0, high_rep_orgs.size());
 		int high_org_id = high_rep_orgs[rand_num];
 
-		for(int i=0; i<cell.ConnectionList().GetSize(); ++i) {
-			const cPopulationCell* faced_cell = cell.ConnectionList().GetFirst();
+		for(int i=0; i<cell.GetNumNeighbors(); ++i) {
+			const cPopulationCell* faced_cell = &cell.GetCellFaced();
 
 			if (IsNeighborCellOccupied()) {
 
@@ -876,7 +893,7 @@ void cPopulationInterface::RotateToGreatestReputationWithDifferentLineage(int li
 				}
 			}
 
-			cell.ConnectionList().CircNext();
+			cell.RotateNext();
 
 		}
 	}
@@ -887,7 +904,8 @@ void cPopulationInterface::RotateToGreatestReputationWithDifferentLineage(int li
 void cPopulationInterface::CreateLinkByFacing(double weight) {
 	cDeme* deme = GetDeme(); assert(deme);
 	cPopulationCell* this_cell = GetCell(); assert(this_cell);
-	cPopulationCell* that_cell = GetCellFaced(); assert(that_cell);
+	cPopulationCell* that_cell = GetCellFaced();
+	if (that_cell == NULL) return;
 	deme->GetNetwork().Connect(*this_cell, *that_cell, weight);
 }
 
@@ -1009,7 +1027,7 @@ void cPopulationInterface::DoHGTDonation(cAvidaContext& ctx) {
 		}
 		case 1: { // faced individual
 			target = GetCellFaced();
-			if(!target->IsOccupied()) {
+			if(target == NULL || !target->IsOccupied()) {
 				// nothing to do, we're facing an empty cell.
 				return;
 			}
@@ -1062,7 +1080,7 @@ void cPopulationInterface::DoHGTConjugation(cAvidaContext& ctx) {
 		}
 		case 1: { // faced individual
 			source = GetCellFaced();
-			if(!source->IsOccupied()) {
+			if(source == NULL || !source->IsOccupied()) {
 				// nothing to do, we're facing an empty cell.
 				return;
 			}
@@ -1283,6 +1301,8 @@ void cPopulationInterface::ReceiveHGTDonation(const InstructionSequence& fragmen
 
 bool cPopulationInterface::Move(cAvidaContext& ctx, int src_id, int dest_id)
 {
+  // A cell without neighbors has no faced cell to move into.
+  if (dest_id < 0) return false;
   return m_world->GetPopulation().MoveOrganisms(ctx, src_id, dest_id, -1);
 }
 
@@ -1603,6 +1623,16 @@ void cPopulationInterface::IncNumTopPredOrganisms()
   m_world->GetPopulation().IncNumTopPredOrganisms();
 }
 
+void cPopulationInterface::UpdateCellOccupancy()
+{
+  if (m_cell_id >= 0) m_world->GetPopulation().UpdateCellOccupancy(m_cell_id);
+}
+
+const cOccupancyIndex* cPopulationInterface::GetOccupancyIndex()
+{
+  return m_world->GetPopulation().GetOccupancyIndex();
+}
+
 void cPopulationInterface::AttackFacedOrg(cAvidaContext& ctx, int loser)
 {
   m_world->GetPopulation().AttackFacedOrg(ctx, loser);
@@ -51,6 +51,8 @@ private:
   int m_prev_task_cell;		// Cell ID of previous task
   int m_num_task_cells;		// Number of task cells seen
 
+  Apto::Array<double> m_no_faced_resources; // Faced resources of a cell without neighbors (all zero)
+
   cPopulationInterface(); // @not_implemented
   cPopulationInterface(const cPopulationInterface&); // @not_implemented
   cPopulationInterface& operator=(const cPopulationInterface&); // @not_implemented
@@ -257,6 +259,8 @@ public:
   void IncNumPreyOrganisms();
   void IncNumPredOrganisms();
   void IncNumTopPredOrganisms();
+  void UpdateCellOccupancy();
+  const cOccupancyIndex* GetOccupancyIndex();
   void AttackFacedOrg(cAvidaContext& ctx, int loser);
 
   void TryWriteBirthLocData(int org_idx);
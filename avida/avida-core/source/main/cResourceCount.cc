@@ -25,6 +25,7 @@
 #include "cGradientCount.h"
 #include "cWorld.h"
 #include "cStats.h"
+#include "cWorkerPool.h"
 
 #include "nGeometry.h"
 
@@ -37,71 +38,12 @@ const double cResourceCount::EPSILON (1.0e-15);
 const int cResourceCount::PRECALC_DISTANCE(100);
 
 
-void FlowMatter(cSpatialCountElem &elem1, cSpatialCountElem &elem2, 
-                double inxdiffuse, 
-                double inydiffuse, double inxgravity, double inygravity,
-                int xdist, int ydist, double dist) {
-
-  /* Routine to calculate the amount of flow from one Element to another.
-     Amount of flow is a function of:
-
-       1) Amount of material in each cell (will try to equalize)
-       2) Distance between each cell
-       3) x and y "gravity"
-
-     This method only effect the delta amount of each element.  The State
-     method will need to be called at the end of each time step to complete
-     the movement of material.
-  */
-
-  double  diff, flowamt, xgravity, xdiffuse, ygravity,  ydiffuse;
-
-  if (((elem1.amount == 0.0) && (elem2.amount == 0.0)) && (dist < 0.0)) return;
-  diff = (elem1.amount - elem2.amount);
-  if (xdist != 0) {
-
-    /* if there is material to be effected by x gravity */
-
-    if (((xdist>0) && (inxgravity>0.0)) || ((xdist<0) && (inxgravity<0.0))) {
-      xgravity = elem1.amount * fabs(inxgravity)/3.0;
-    } else {
-      xgravity = -elem2.amount * fabs(inxgravity)/3.0;
-    }
-    
-    /* Diffusion uses the diffusion constant x half the difference (as the 
-       elements attempt to equalize) / the number of possible neighbors (8) */
-
-    xdiffuse = inxdiffuse * diff / 16.0;
-  } else {
-    xdiffuse = 0.0;
-    xgravity = 0.0;
-  }  
-  if (ydist != 0) {
-
-    /* if there is material to be effected by y gravity */
-
-    if (((ydist>0) && (inygravity>0.0)) || ((ydist<0) && (inygravity<0.0))) {
-      ygravity = elem1.amount * fabs(inygravity)/3.0;
-    } else {
-      ygravity = -elem2.amount * fabs(inygravity)/3.0;
-    }
-    ydiffuse = inydiffuse * diff / 16.0;
-  } else {
-    ydiffuse = 0.0;
-    ygravity = 0.0;
-  }  
-
-  flowamt = ((xdiffuse + ydiffuse + xgravity + ygravity)/
-             (fabs(xdist*1.0) + fabs(ydist*1.0)))/dist;
-  elem1.delta -= flowamt;
-  elem2.delta += flowamt;
-}
-
 cResourceCount::cResourceCount(int num_resources)
   : update_time(0.0)
   , spatial_update_time(0.0)
   , m_last_updated(0)
   , m_spatial_update(0)
+  , m_worker_pool(NULL)
 {
   if(num_resources > 0) {
     SetSize(num_resources);
@@ -110,7 +52,7 @@ cResourceCount::cResourceCount(int num_resources)
   return;
 }
 
-cResourceCount::cResourceCount(const cResourceCount &rc) {
+cResourceCount::cResourceCount(const cResourceCount &rc) : m_worker_pool(NULL) {
   *this = rc;
 
   return;
@@ -332,6 +274,7 @@ void cResourceCount::Setup(cWorld* world, const int& res_index, const cString& n
   spatial_resource_count[res_index]->SetGeometry(in_geometry);
   spatial_resource_count[res_index]->SetPointers();
   spatial_resource_count[res_index]->SetCellList(in_cell_list_ptr);
+  if (world) spatial_resource_count[res_index]->SetEpsilon(world->GetConfig().SPATIAL_RES_EPSILON.Get());
 
   double step_decay = pow(decay, UPDATE_STEP);
   double step_inflow = inflow * UPDATE_STEP;
@@ -657,7 +600,7 @@ void cResourceCount::ModifyCell(cAvidaContext& ctx, const Apto::Array<double> &
         resource_count[i] += res_change[i];
       assert(resource_count[i] >= 0.0);
     } else {
-      double temp = spatial_resource_count[i]->Element(cell_id).GetAmount();
+      double temp = spatial_resource_count[i]->GetAmount(cell_id);
       spatial_resource_count[i]->Rate(cell_id, res_change[i]);
       /* Ideally the state of the cell's resource should not be set till
          the end of the update so that all processes (inflow, outflow, 
@@ -666,10 +609,10 @@ void cResourceCount::ModifyCell(cAvidaContext& ctx, const Apto::Array<double> &
          the organism demand to work immediately on the state of the resource */ 
     
       spatial_resource_count[i]->State(cell_id);
-      if(spatial_resource_count[i]->Element(cell_id).GetAmount() != temp){
+      if(spatial_resource_count[i]->GetAmount(cell_id) != temp){
         spatial_resource_count[i]->SetModified(true);
       }
-      assert(spatial_resource_count[i]->Element(cell_id).GetAmount() >= 0.0);
+      assert(spatial_resource_count[i]->GetAmount(cell_id) >= 0.0);
     }
   }
 }
@@ -798,13 +741,23 @@ void cResourceCount::DoUpdates(cAvidaContext& ctx, bool global_only) const
   
   
   // DO UPDATE FOR EACH RESOURCE ================================================
+  // Spatial resources that do not depend on the context are independent of one another; with a worker pool each run
+  // of them between serial spatial resources is updated concurrently, so resources still update in declaration order.
+  // Global resources touch nothing a spatial update does, so they do not break a run.
+  m_concurrent_res.Resize(0);
   for (int res_id = 0; res_id < resource_count.GetSize(); res_id++) {
     if (!IsSpatialResource(res_id)) {
       DoNonSpatialUpdates(ctx, res_id, num_steps);
     } else if (!global_only){
-      DoSpatialUpdates(ctx, res_id, num_spatial_updates);
+      if (m_worker_pool && num_spatial_updates > 0 && !spatial_resource_count[res_id]->RequiresSerialUpdate()) {
+        m_concurrent_res.Push(res_id);
+      } else {
+        if (m_concurrent_res.GetSize()) DoConcurrentSpatialUpdates(ctx, num_spatial_updates);
+        DoSpatialUpdates(ctx, res_id, num_spatial_updates);
+      }
     }
   }
+  if (m_concurrent_res.GetSize()) DoConcurrentSpatialUpdates(ctx, num_spatial_updates);
   
   if (!global_only){
     m_last_updated = m_spatial_update;
@@ -827,7 +780,38 @@ void cResourceCount::DoNonSpatialUpdates(cAvidaContext& ctx, const int res_id, i
 
 
 
-void cResourceCount::DoSpatialUpdates(cAvidaContext& ctx, const int res_id, int num_updates) const
+class cResourceCount::cSpatialUpdateJob : public cWorkerPool::cJob
+{
+private:
+  const cResourceCount& m_res_count;
+  cAvidaContext& m_ctx;
+  int m_num_updates;
+  
+public:
+  cSpatialUpdateJob(const cResourceCount& res_count, cAvidaContext& ctx, int num_updates)
+    : m_res_count(res_count), m_ctx(ctx), m_num_updates(num_updates) { ; }
+  
+  void Run(int item) { m_res_count.DoSpatialUpdates(m_ctx, m_res_count.m_concurrent_res[item], m_num_updates); }
+};
+
+
+void cResourceCount::DoConcurrentSpatialUpdates(cAvidaContext& ctx, int num_updates) const
+{
+  // With enough resources to go around, each worker takes whole resources.  Otherwise the resources are done one at a
+  // time, and the flow calculation on each (large) grid is split into row stripes instead.
+  const int num_res = m_concurrent_res.GetSize();
+  const bool large_grid = spatial_resource_count[m_concurrent_res[0]]->GetSize() >= cSpatialResCount::PARALLEL_FLOW_CELLS;
+  if (num_res >= m_worker_pool->GetNumThreads() || !large_grid) {
+    cSpatialUpdateJob job(*this, ctx, num_updates);
+    m_worker_pool->Execute(job, num_res);
+  } else {
+    for (int i = 0; i < num_res; i++) DoSpatialUpdates(ctx, m_concurrent_res[i], num_updates, m_worker_pool);
+  }
+  m_concurrent_res.Resize(0);
+}
+
+
+void cResourceCount::DoSpatialUpdates(cAvidaContext& ctx, const int res_id, int num_updates, cWorkerPool* flow_pool) const
 {
   for (int kk=0; kk < num_updates; kk++){
     spatial_resource_count[res_id]->UpdateCount(ctx);  //Only for Gradient Resources
@@ -837,7 +821,7 @@ void cResourceCount::DoSpatialUpdates(cAvidaContext& ctx, const int res_id, int
       spatial_resource_count[res_id]->CellInflow();
       spatial_resource_count[res_id]->CellOutflow();
     }
-    spatial_resource_count[res_id]->FlowAll();
+    spatial_resource_count[res_id]->FlowAll(flow_pool);
     spatial_resource_count[res_id]->StateAll();
     // BDB: resource_count[res_ndx] = spatial_resource_count[i]->SumAll();
   }
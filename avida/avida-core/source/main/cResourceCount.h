@@ -31,6 +31,7 @@
 #include "tMatrix.h"
 #include "nGeometry.h"
 
+class cWorkerPool;
 class cWorld;
 
 
@@ -80,11 +81,17 @@ private:
   mutable double spatial_update_time;
   mutable int m_last_updated;
   mutable int m_spatial_update;
+  
+  // Optional pool for updating spatial resources concurrently (not owned, not copied)
+  cWorkerPool* m_worker_pool;
+  mutable Apto::Array<int> m_concurrent_res;
+  class cSpatialUpdateJob;
 
   void DoUpdates(cAvidaContext& ctx, bool global_only = false) const;         // Update resource count based on update time
   
   void DoNonSpatialUpdates(cAvidaContext& ctx, const int res_id, int num_steps) const;
-  void DoSpatialUpdates(cAvidaContext& ctx, const int res_id, int num_updates) const;
+  void DoSpatialUpdates(cAvidaContext& ctx, const int res_id, int num_updates, cWorkerPool* flow_pool = NULL) const;
+  void DoConcurrentSpatialUpdates(cAvidaContext& ctx, int num_updates) const;
 
   // A few constants to describe update process...
   static const double UPDATE_STEP;   // Fraction of an update per step
@@ -99,6 +106,7 @@ public:
   const cResourceCount& operator=(const cResourceCount&);
 
   void SetSize(int num_resources);
+  void SetWorkerPool(cWorkerPool* pool) { m_worker_pool = pool; }
   void SetCellResources(int cell_id, const Apto::Array<double> & res);
 
   void Setup(cWorld* world, const int& id, const cString& name, const double& initial, const double& inflow, const double& decay,                      
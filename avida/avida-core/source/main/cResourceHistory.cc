@@ -26,24 +26,67 @@
 #include "cStringList.h"
 
 
+void cResourceHistory::indexEntry(int entry)
+{
+  if (entry == 0) {
+    m_sorted = true;
+    m_update_stride = 1;
+    return;
+  }
+  if (!m_sorted) return;
+  
+  const int step = m_entries[entry].update - m_entries[entry - 1].update;
+  if (step <= 0) {
+    m_sorted = false;
+    m_update_stride = 0;
+  } else if (entry == 1) {
+    m_update_stride = step;
+  } else if (step != m_update_stride) {
+    m_update_stride = 0;
+  }
+}
+
 int cResourceHistory::getEntryForUpdate(int update, bool exact) const
 {
+  const int num_entries = m_entries.GetSize();
   int entry = -1;
   
-  if (exact) {
-    for (int i = 0; i < m_entries.GetSize(); i++) {
-      if (update == m_entries[i].update) {
-        entry = i;
-        break;
+  if (!m_sorted) {
+    if (exact) {
+      for (int i = 0; i < num_entries; i++) {
+        if (update == m_entries[i].update) {
+          entry = i;
+          break;
+        }
       }
+    } else {
+      // Find the update that is closest to the born update, round down
+      entry = 0;
+      for (; entry < num_entries; entry++) if (m_entries[entry].update > update) break;
+      if (entry > 0) entry--;
     }
+    return entry;
+  }
+  
+  // Updates before the first entry round down to it, just as the scan above would
+  if (num_entries == 0 || update < m_entries[0].update) return (exact) ? -1 : 0;
+  
+  if (m_update_stride > 0) {
+    entry = (update - m_entries[0].update) / m_update_stride;
+    if (entry >= num_entries) entry = num_entries - 1;
   } else {
-    // Find the update that is closest to the born update, round down
-    entry = 0;
-    for (; entry < m_entries.GetSize(); entry++) if (m_entries[entry].update > update) break;
-    if (entry > 0) entry--;
+    // Last entry at or before the requested update
+    int lo = 0;
+    int hi = num_entries - 1;
+    while (lo < hi) {
+      const int mid = (lo + hi + 1) / 2;
+      if (m_entries[mid].update <= update) lo = mid;
+      else hi = mid - 1;
+    }
+    entry = lo;
   }
-
+  
+  if (exact && m_entries[entry].update != update) return -1;
   return entry;
 }
 
@@ -51,15 +94,10 @@ bool cResourceHistory::GetResourceCountForUpdate(cAvidaContext& ctx, int update,
 {
   int entry = getEntryForUpdate(update, exact);
   if (entry == -1) return false;
-      
-  for (int i = 0; i < rc.GetSize(); i++) {
-    if (entry >= m_entries.GetSize() || i >= m_entries[entry].values.GetSize()) {
-			rc.Set(ctx, i, 0.0);
-		}
-    else {
-			rc.Set(ctx, i, m_entries[entry].values[i]);
-		}
-  }
+  
+  // Resources missing from the entry (or an empty history) default to zero
+  const int num_values = (entry < m_entries.GetSize()) ? m_entries[entry].values.GetSize() : 0;
+  for (int i = 0; i < rc.GetSize(); i++) rc.Set(ctx, i, (i < num_values) ? m_entries[entry].values[i] : 0.0);
   
   return true;
 }
@@ -69,11 +107,8 @@ bool cResourceHistory::GetResourceLevelsForUpdate(int update, Apto::Array<double
   int entry = getEntryForUpdate(update, exact);
   if (entry == -1) return false;
   
-  levels.Resize(m_entries[entry].values.GetSize());
-  for (int i = 0; i < levels.GetSize(); i++) {
-    if (entry >= m_entries.GetSize()) levels[i] = 0.0;
-    else levels[i] = m_entries[entry].values[i];
-  }
+  if (entry >= m_entries.GetSize()) levels.Resize(0);
+  else levels = m_entries[entry].values;
   
   return true;
 }
@@ -87,6 +122,7 @@ void cResourceHistory::AddEntry(int update, const Apto::Array<double>& values)
   m_entries.Resize(new_entry + 1);
   m_entries[new_entry].update = update;
   m_entries[new_entry].values = values;
+  indexEntry(new_entry);
 }
 
 bool cResourceHistory::LoadFile(const cString& filename, const cString& working_dir)
@@ -111,6 +147,7 @@ bool cResourceHistory::LoadFile(const cString& filename, const cString& working_
     int num_values = cur_line.GetSize();
     m_entries[line].values.Resize(num_values);
     for (int i = 0; i < num_values; i++) m_entries[line].values[i] = cur_line.Pop().AsDouble();
+    indexEntry(line);
   }
   
   return true;
@@ -38,8 +38,11 @@ private:
   };
   
   Apto::Array<sResourceHistoryEntry> m_entries;
+  bool m_sorted;        // Entry updates are strictly increasing, so lookups may search rather than scan
+  int m_update_stride;  // Spacing of entry updates when they are evenly spaced (lookups index directly), 0 otherwise
   
   
+  void indexEntry(int entry);
   int getEntryForUpdate(int update, bool exact) const;
   
   
@@ -47,7 +50,7 @@ private:
   cResourceHistory& operator=(const cResourceHistory&); // @not_implemented
   
 public:
-  cResourceHistory() { ; }
+  cResourceHistory() : m_sorted(true), m_update_stride(1) { ; }
   
   bool GetResourceCountForUpdate(cAvidaContext& ctx, int update, cResourceCount& rc, bool exact = false) const;
   bool GetResourceLevelsForUpdate(int update, Apto::Array<double>& levels, bool exact = false) const;
@@ -58,6 +58,8 @@ cResource* cResourceLib::GetResource(const cString& res_name) const
 
 const cResourceHistory& cResourceLib::GetInitialResourceLevels() const
 {
+  // Test CPUs on different threads share the initial levels, so only one of them may build it
+  Apto::MutexAutoLock lock(m_initial_levels_mutex);
   if (!m_initial_levels) {
     Apto::Array<double> levels(m_resource_array.GetSize());
     for (int i = 0; i < m_resource_array.GetSize(); i++) levels[i] = m_resource_array[i]->GetInitial();
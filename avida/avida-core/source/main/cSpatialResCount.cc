@@ -22,6 +22,7 @@
 #include "cSpatialResCount.h"
 
 #include "AvidaTools.h"
+#include "cWorkerPool.h"
 #include "nGeometry.h"
 
 #include <cmath>
@@ -29,52 +30,94 @@
 using namespace std;
 using namespace AvidaTools;
 
+
+const double cSpatialResCount::SPARSE_MAX_OCCUPANCY = 0.5;
+
+/* Routine to calculate the amount of flow from one cell to another.
+   Amount of flow is a function of:
+
+     1) Amount of material in each cell (will try to equalize)
+     2) Distance between each cell
+     3) x and y "gravity"
+
+   The direction is fixed at compile time so that the per-direction passes in
+   calcFlows() reduce to branch-free arithmetic the compiler can vectorize.  The
+   arithmetic itself must stay exactly as written, so that results do not depend
+   on how the passes are scheduled. */
+
+template <int XDIST, int YDIST>
+static inline double FlowMatter(double amount1, double amount2, double inxdiffuse, double inydiffuse,
+                                double inxgravity, double inygravity, double dist)
+{
+  double  diff, xgravity, xdiffuse, ygravity,  ydiffuse;
+  
+  diff = (amount1 - amount2);
+  if (XDIST != 0) {
+
+    /* if there is material to be effected by x gravity */
+
+    if (((XDIST>0) && (inxgravity>0.0)) || ((XDIST<0) && (inxgravity<0.0))) {
+      xgravity = amount1 * fabs(inxgravity)/3.0;
+    } else {
+      xgravity = -amount2 * fabs(inxgravity)/3.0;
+    }
+    
+    /* Diffusion uses the diffusion constant x half the difference (as the 
+       elements attempt to equalize) / the number of possible neighbors (8) */
+
+    xdiffuse = inxdiffuse * diff / 16.0;
+  } else {
+    xdiffuse = 0.0;
+    xgravity = 0.0;
+  }  
+  if (YDIST != 0) {
+
+    /* if there is material to be effected by y gravity */
+
+    if (((YDIST>0) && (inygravity>0.0)) || ((YDIST<0) && (inygravity<0.0))) {
+      ygravity = amount1 * fabs(inygravity)/3.0;
+    } else {
+      ygravity = -amount2 * fabs(inygravity)/3.0;
+    }
+    ydiffuse = inydiffuse * diff / 16.0;
+  } else {
+    ydiffuse = 0.0;
+    ygravity = 0.0;
+  }  
+
+  return ((xdiffuse + ydiffuse + xgravity + ygravity)/
+          (fabs(XDIST*1.0) + fabs(YDIST*1.0)))/dist;
+}
+
+
 /* Setup a single spatial resource with known flows */
 
 cSpatialResCount::cSpatialResCount(int inworld_x, int inworld_y, int ingeometry, double inxdiffuse, double inydiffuse,
                                    double inxgravity, double inygravity)
-: grid(inworld_x * inworld_y), m_initial(0.0), m_modified(false)
+: m_initial(0.0), m_epsilon(0.0), m_modified(false)
 {
-  int i;
- 
   xdiffuse = inxdiffuse;
   ydiffuse = inydiffuse;
   xgravity = inxgravity;
   ygravity = inygravity;
-  world_x = inworld_x;
-  world_y = inworld_y;
-  geometry = ingeometry;
-  num_cells = world_x * world_y;
-  for (i = 0; i < GetSize(); i++) {
-    cSpatialCountElem tmpelem;
-    grid[i] = tmpelem;
-  } 
-  SetPointers();
+  ResizeClear(inworld_x, inworld_y, ingeometry);
 }
 
 /* Setup a single spatial resource using default flow amounts  */
 
 cSpatialResCount::cSpatialResCount(int inworld_x, int inworld_y, int ingeometry)
-: grid(inworld_x * inworld_y), m_initial(0.0), m_modified(false)
+: m_initial(0.0), m_epsilon(0.0), m_modified(false)
 {
-  int i;
- 
   xdiffuse = 1.0;
   ydiffuse = 1.0;
   xgravity = 0.0;
   ygravity = 0.0;
-  world_x = inworld_x;
-  world_y = inworld_y;
-  geometry = ingeometry;
-  num_cells = world_x * world_y;
-  for (i = 0; i < GetSize(); i++) {
-    cSpatialCountElem tmpelem;
-    grid[i] = tmpelem;
-   } 
-   SetPointers();
+  ResizeClear(inworld_x, inworld_y, ingeometry);
 }
 
-cSpatialResCount::cSpatialResCount() : m_initial(0.0), xdiffuse(1.0), ydiffuse(1.0), xgravity(0.0), ygravity(0.0), m_modified(false)
+cSpatialResCount::cSpatialResCount()
+  : m_initial(0.0), m_epsilon(0.0), xdiffuse(1.0), ydiffuse(1.0), xgravity(0.0), ygravity(0.0)
+  , world_x(0), world_y(0), num_cells(0), m_modified(false)
 {
   geometry = nGeometry::GLOBAL;
 }
@@ -84,67 +127,88 @@ cSpatialResCount::~cSpatialResCount() { ; }
 
 void cSpatialResCount::ResizeClear(int inworld_x, int inworld_y, int ingeometry)
 {
-  int i;
- 
-  grid.ResizeClear(inworld_x * inworld_y); 
   world_x = inworld_x;
   world_y = inworld_y;
   geometry = ingeometry;
   num_cells = world_x * world_y;
-  for (i = 0; i < GetSize(); i++) {
-    cSpatialCountElem tmpelem;
-    grid[i] = tmpelem;
-   } 
-   SetPointers();
+  
+  m_amount.ResizeClear(num_cells);
+  m_amount.SetAll(0.0);
+  m_delta.ResizeClear(num_cells);
+  m_delta.SetAll(0.0);
+  m_cell_initial.ResizeClear(num_cells);
+  m_cell_initial.SetAll(0.0);
+  m_flow.ResizeClear(num_cells * NUM_FLOW_DIRS);
+  m_flow.SetAll(0.0);
+  
+  // Nothing is active (spans are empty when lo > hi) and no flows are stale
+  m_active_lo.ResizeClear(world_y);
+  m_active_lo.SetAll(world_x);
+  m_active_hi.ResizeClear(world_y);
+  m_active_hi.SetAll(-1);
+  m_flow_lo.ResizeClear(world_y);
+  m_flow_lo.SetAll(world_x);
+  m_flow_hi.ResizeClear(world_y);
+  m_flow_hi.SetAll(-1);
+  
+  SetPointers();
 }
 
-void cSpatialResCount::SetPointers()
+
+/* Find the neighbor a cell flows into in the given direction.  All cells are
+   treated like they are in a torus, except that a bounded grid has no links
+   across its top, bottom and sides. */
+
+int cSpatialResCount::flowNeighbor(int cell_id, int dir) const
 {
-  /* Pointer 0 will point to the cell above and to the left the current cell
-     and will go clockwise around the cell.                               */
-
-  int     i,ii;
-  double  SQRT2 = sqrt(2.0);
-
-  /* First treat all cells like they are in a torus */
-
-  for (i = 0; i < GetSize(); i++) {
-    grid[i].SetPtr(0 ,GridNeighbor(i, world_x, world_y, -1, -1), -1, -1, SQRT2);
-    grid[i].SetPtr(1 ,GridNeighbor(i, world_x, world_y,  0, -1),  0, -1, 1.0);
-    grid[i].SetPtr(2 ,GridNeighbor(i, world_x, world_y, +1, -1), +1, -1, SQRT2);
-    grid[i].SetPtr(3 ,GridNeighbor(i, world_x, world_y, +1,  0), +1,  0, 1.0);
-    grid[i].SetPtr(4 ,GridNeighbor(i, world_x, world_y, +1, +1), +1, +1, SQRT2);
-    grid[i].SetPtr(5 ,GridNeighbor(i, world_x, world_y,  0, +1),  0, +1, 1.0);
-    grid[i].SetPtr(6 ,GridNeighbor(i, world_x, world_y, -1, +1), -1, +1, SQRT2);
-    grid[i].SetPtr(7 ,GridNeighbor(i, world_x, world_y, -1,  0), -1,  0, 1.0);
-  }
- 
-  /* Fix links for top, bottom and sides for non-torus */
+  static const int dir_x[NUM_FLOW_DIRS] = { +1, +1,  0, -1 };
+  static const int dir_y[NUM_FLOW_DIRS] = {  0, +1, +1, +1 };
   
   if (geometry == nGeometry::GRID) {
-    /* Top and bottom */
-
-    for (i = 0; i < world_x; i++) {
-      grid[i].SetPtr(0, cResource::NONE, cResource::NONE, cResource::NONE, cResource::NONE);
-      grid[i].SetPtr(1, cResource::NONE, cResource::NONE, cResource::NONE, cResource::NONE);
-      grid[i].SetPtr(2, cResource::NONE, cResource::NONE, cResource::NONE, cResource::NONE);
-      ii = num_cells-1-i;
-      grid[ii].SetPtr(4, cResource::NONE, cResource::NONE, cResource::NONE, cResource::NONE);
-      grid[ii].SetPtr(5, cResource::NONE, cResource::NONE, cResource::NONE, cResource::NONE);
-      grid[ii].SetPtr(6, cResource::NONE, cResource::NONE, cResource::NONE, cResource::NONE);
-    }
+    const int x = cell_id % world_x + dir_x[dir];
+    const int y = cell_id / world_x + dir_y[dir];
+    if (x < 0 || x >= world_x || y >= world_y) return cResource::NONE;
+  }
+  return GridNeighbor(cell_id, world_x, world_y, dir_x[dir], dir_y[dir]);
+}
+
+
+/* Flow into a cell must be summed in the same order regardless of how the
+   passes are organized, or results would drift in the last bits from one build
+   to the next.  The reference order is that of a sweep over the cells in index
+   order, each cell pushing its east, southeast, south and southwest flows.
+
+   For interior cells that order is always: flow in from the NW, N, NE and W
+   neighbors, then flow out E, SE, S and SW -- which gatherFlows() applies as a
+   fixed stencil.  Cells on the border see wrapped neighbors whose indices
+   land elsewhere in that order, so their term lists are built here by replaying
+   the sweep once. */
 
-    /* fix links for right and left sides */
-
-    for (i = 0; i < world_y; i++) {
-      ii = i * world_x;    
-      grid[ii].SetPtr(0, cResource::NONE, cResource::NONE, cResource::NONE, cResource::NONE);
-      grid[ii].SetPtr(7, cResource::NONE, cResource::NONE, cResource::NONE, cResource::NONE);
-      grid[ii].SetPtr(6, cResource::NONE, cResource::NONE, cResource::NONE, cResource::NONE);
-      ii = ((i + 1) * world_x) - 1;
-      grid[ii].SetPtr(2, cResource::NONE, cResource::NONE, cResource::NONE, cResource::NONE);
-      grid[ii].SetPtr(3, cResource::NONE, cResource::NONE, cResource::NONE, cResource::NONE);
-      grid[ii].SetPtr(4, cResource::NONE, cResource::NONE, cResource::NONE, cResource::NONE);
+void cSpatialResCount::SetPointers()
+{
+  m_edge_slot.ResizeClear(num_cells);
+  m_edge_slot.SetAll(-1);
+  m_edge_cells.ResizeClear(0);
+  
+  for (int i = 0; i < num_cells; i++) {
+    const int x = i % world_x;
+    const int y = i / world_x;
+    if (!hasInteriorStencil() || y == 0 || x == 0 || x == world_x - 1) {
+      m_edge_slot[i] = m_edge_cells.GetSize();
+      m_edge_cells.Push(i);
+    }
+  }
+  
+  m_edge_terms.ResizeClear(m_edge_cells.GetSize());
+  for (int i = 0; i < m_edge_terms.GetSize(); i++) m_edge_terms[i].ResizeClear(0);
+  
+  for (int i = 0; i < num_cells; i++) {
+    for (int dir = 0; dir < NUM_FLOW_DIRS; dir++) {
+      const int ii = flowNeighbor(i, dir);
+      if (ii < 0) continue;
+      const int flow_idx = dir * num_cells + i;
+      if (m_edge_slot[i] >= 0) m_edge_terms[m_edge_slot[i]].Push((flow_idx << 1) | 1);
+      if (m_edge_slot[ii] >= 0) m_edge_terms[m_edge_slot[ii]].Push(flow_idx << 1);
     }
   }
 }
@@ -222,10 +286,10 @@ void cSpatialResCount::SetCellList(Apto::Array<cCellResource>* in_cell_list_ptr)
     /* Be sure the user entered a valid cell id or if the the program is loading
        the resource for the testCPU that does not have a grid set up */
        
-    if (cell_id >= 0 && cell_id <= grid.GetSize()) {
+    if (cell_id >= 0 && cell_id < num_cells) {
       Rate((*cell_list_ptr)[i].GetId(), (*cell_list_ptr)[i].GetInitial());
       State((*cell_list_ptr)[i].GetId());
-      Element(cell_id).SetInitial((*cell_list_ptr)[i].GetInitial());
+      m_cell_initial[cell_id] = (*cell_list_ptr)[i].GetInitial();
     }
   }
 }
@@ -233,8 +297,9 @@ void cSpatialResCount::SetCellList(Apto::Array<cCellResource>* in_cell_list_ptr)
 /* Set the rate variable for one element using the array index */
 
 void cSpatialResCount::Rate(int x, double ratein) const {
-  if (x >= 0 && x < grid.GetSize()) {
-    grid[x].Rate(ratein);
+  if (x >= 0 && x < num_cells) {
+    m_delta[x] += ratein;
+    markCell(x);
   } else {
     assert(false); // x not valid id
   }
@@ -244,7 +309,8 @@ void cSpatialResCount::Rate(int x, double ratein) const {
 
 void cSpatialResCount::Rate(int x, int y, double ratein) const { 
   if (x >= 0 && x < world_x && y>= 0 && y < world_y) {
-    grid[y * world_x + x].Rate(ratein);
+    m_delta[y * world_x + x] += ratein;
+    markCell(y * world_x + x);
   } else {
     assert(false); // x or y not valid id
   }
@@ -254,8 +320,9 @@ void cSpatialResCount::Rate(int x, int y, double ratein) const {
    the array index */
    
 void cSpatialResCount::State(int x) { 
-  if (x >= 0 && x < grid.GetSize()) {
-    grid[x].State();
+  if (x >= 0 && x < num_cells) {
+    m_amount[x] += m_delta[x];
+    m_delta[x] = 0.0;
   } else {
     assert(false); // x not valid id
   }
@@ -266,7 +333,7 @@ void cSpatialResCount::State(int x) {
    
 void cSpatialResCount::State(int x, int y) { 
   if (x >= 0 && x < world_x && y >= 0 && y < world_y) {
-    grid[y*world_x + x].State();
+    State(y * world_x + x);
   } else {
     assert(false); // x or y not valid id
   }
@@ -275,8 +342,8 @@ void cSpatialResCount::State(int x, int y) {
 /* Get the state of one element using the array index */
 
 double cSpatialResCount::GetAmount(int x) const { 
-  if (x >= 0 && x < grid.GetSize()) {
-    return grid[x].GetAmount(); 
+  if (x >= 0 && x < num_cells) {
+    return m_amount[x]; 
   } else {
     return cResource::NONE;
   }
@@ -286,69 +353,335 @@ double cSpatialResCount::GetAmount(int x) const {
 
 double cSpatialResCount::GetAmount(int x, int y) const { 
   if (x >= 0 && x < world_x && y >= 0 && y < world_y) {
-    return grid[y*world_x + x].GetAmount(); 
+    return m_amount[y * world_x + x]; 
   } else {
     return cResource::NONE;
   }
 }
 
 void cSpatialResCount::RateAll(double ratein) {
-
-  int i;
- 
-  for (i = 0; i < num_cells; i++) {
-    grid[i].Rate(ratein);
-  } 
+  if (num_cells == 0) return;
+  double* delta = &m_delta[0];
+  for (int i = 0; i < num_cells; i++) delta[i] += ratein;
+  if (ratein != 0.0) markAll();
 }
 
 /* For each cell in the grid add the changes stored in the rate variable
-   with the total of the resource */
+   with the total of the resource.  Only the active span of each row can hold
+   a non-zero delta; the spans are then shrunk to the cells that still hold
+   resource. */
 
 void cSpatialResCount::StateAll() {
+  if (num_cells == 0) return;
+  double* amount = &m_amount[0];
+  double* delta = &m_delta[0];
+  
+  for (int y = 0; y < world_y; y++) {
+    int lo = m_active_lo[y];
+    int hi = m_active_hi[y];
+    if (lo > hi) continue;
+    
+    const int row = y * world_x;
+    for (int i = row + lo; i <= row + hi; i++) {
+      amount[i] += delta[i];
+      delta[i] = 0.0;
+    }
+    if (m_epsilon > 0.0) {
+      for (int i = row + lo; i <= row + hi; i++) if (fabs(amount[i]) <= m_epsilon) amount[i] = 0.0;
+    }
+    
+    while (lo <= hi && amount[row + lo] == 0.0) lo++;
+    while (hi >= lo && amount[row + hi] == 0.0) hi--;
+    m_active_lo[y] = lo;
+    m_active_hi[y] = hi;
+  }
+}
+
+
+/* Zero the amount in the cells [x_lo, x_hi] of a row (deltas are left alone),
+   then shrink the row's active span to the cells that still hold an amount or a
+   delta.  Only the part of the range inside the active span is touched. */
 
-  int i;
- 
-  for (i = 0; i < num_cells; i++) {
-    grid[i].State();
-  } 
+void cSpatialResCount::ClearRowRange(int y, int x_lo, int x_hi)
+{
+  const int clear_lo = Apto::Max(m_active_lo[y], x_lo);
+  const int clear_hi = Apto::Min(m_active_hi[y], x_hi);
+  if (clear_lo > clear_hi) return;
+  
+  double* amount = &m_amount[y * world_x];
+  for (int x = clear_lo; x <= clear_hi; x++) amount[x] = 0.0;
+  trimRow(y);
 }
 
-void cSpatialResCount::FlowAll() {
 
-  // @JEB save time if diffusion and gravity off...
-  if ((xdiffuse == 0.0) && (ydiffuse == 0.0) && (xgravity == 0.0) && (ygravity == 0.0)) return;
+/* Shrink every row's active span to the cells that hold an amount or a delta,
+   without applying the deltas. */
+
+void cSpatialResCount::TrimActiveSpans()
+{
+  if (num_cells == 0) return;
+  for (int y = 0; y < world_y; y++) trimRow(y);
+}
+
+
+/* Shrink a row's active span to the cells that hold an amount or a delta */
 
-  int     i,k,ii,xdist,ydist;
-  double  dist;
- 
-  for (i = 0; i < num_cells; i++) {
-      
-    /* because flow is two way we must check only half the neighbors to 
-       prevent double flow calculations */
-
-    for (k = 3; k <= 6; k++) {
-      ii = grid[i].GetElemPtr(k);
-      xdist = grid[i].GetPtrXdist(k);
-      ydist = grid[i].GetPtrYdist(k);
-      dist = grid[i].GetPtrDist(k);
-      if (ii >= 0) {
-        FlowMatter(grid[i],grid[ii],xdiffuse,ydiffuse,xgravity,ygravity,
-                   xdist, ydist, dist);
+void cSpatialResCount::trimRow(int y)
+{
+  int lo = m_active_lo[y];
+  int hi = m_active_hi[y];
+  const double* amount = &m_amount[y * world_x];
+  const double* delta = &m_delta[y * world_x];
+  while (lo <= hi && amount[lo] == 0.0 && delta[lo] == 0.0) lo++;
+  while (hi >= lo && amount[hi] == 0.0 && delta[hi] == 0.0) hi--;
+  m_active_lo[y] = lo;
+  m_active_hi[y] = hi;
+}
+
+
+/* Grow a row's active span to include a cell */
+
+inline void cSpatialResCount::markCell(int cell_id) const
+{
+  const int y = cell_id / world_x;
+  const int x = cell_id % world_x;
+  if (x < m_active_lo[y]) m_active_lo[y] = x;
+  if (x > m_active_hi[y]) m_active_hi[y] = x;
+}
+
+void cSpatialResCount::markAll() const
+{
+  m_active_lo.SetAll(0);
+  m_active_hi.SetAll(world_x - 1);
+}
+
+
+/* Compute this step's flow out of cells [x_begin, x_end) of a row in each of
+   the four directions.  The neighbor row is just an offset, and the wrapped end
+   columns are done separately, so the inner loops are plain streams over
+   m_amount. */
+
+void cSpatialResCount::calcFlowRow(int y, int x_begin, int x_end)
+{
+  const double SQRT2 = sqrt(2.0);
+  const bool bounded = (geometry == nGeometry::GRID);
+  const double xd = xdiffuse, yd = ydiffuse, xg = xgravity, yg = ygravity;
+  const int last_x = world_x - 1;
+  const int row = y * world_x;
+  const int down = ((y + 1) % world_y) * world_x;
+  const double* a = &m_amount[0] + row;
+  const double* a_down = &m_amount[0] + down;
+  double* flow_e = &m_flow[0] + FLOW_E * num_cells + row;
+  double* flow_se = &m_flow[0] + FLOW_SE * num_cells + row;
+  double* flow_s = &m_flow[0] + FLOW_S * num_cells + row;
+  double* flow_sw = &m_flow[0] + FLOW_SW * num_cells + row;
+  const int run_end = Apto::Min(x_end, last_x);
+  
+  for (int x = x_begin; x < run_end; x++) flow_e[x] = FlowMatter<+1, 0>(a[x], a[x + 1], xd, yd, xg, yg, 1.0);
+  if (x_end > last_x) flow_e[last_x] = bounded ? 0.0 : FlowMatter<+1, 0>(a[last_x], a[0], xd, yd, xg, yg, 1.0);
+  
+  if (bounded && y == world_y - 1) {
+    for (int x = x_begin; x < x_end; x++) {
+      flow_se[x] = 0.0;
+      flow_s[x] = 0.0;
+      flow_sw[x] = 0.0;
+    }
+    return;
+  }
+  
+  for (int x = x_begin; x < run_end; x++) flow_se[x] = FlowMatter<+1, +1>(a[x], a_down[x + 1], xd, yd, xg, yg, SQRT2);
+  if (x_end > last_x) flow_se[last_x] = bounded ? 0.0 : FlowMatter<+1, +1>(a[last_x], a_down[0], xd, yd, xg, yg, SQRT2);
+  
+  for (int x = x_begin; x < x_end; x++) flow_s[x] = FlowMatter<0, +1>(a[x], a_down[x], xd, yd, xg, yg, 1.0);
+  
+  if (x_begin == 0) flow_sw[0] = bounded ? 0.0 : FlowMatter<-1, +1>(a[0], a_down[last_x], xd, yd, xg, yg, SQRT2);
+  for (int x = Apto::Max(x_begin, 1); x < x_end; x++) {
+    flow_sw[x] = FlowMatter<-1, +1>(a[x], a_down[x - 1], xd, yd, xg, yg, SQRT2);
+  }
+}
+
+void cSpatialResCount::calcFlows(int row_begin, int row_end)
+{
+  for (int y = row_begin; y < row_end; y++) calcFlowRow(y, 0, world_x);
+}
+
+
+/* Sum this step's flows into the deltas of interior cells [x_begin, x_end) of a
+   row, in the order described at SetPointers() */
+
+void cSpatialResCount::gatherFlowRow(int y, int x_begin, int x_end)
+{
+  const double* flow = &m_flow[0];
+  const double* flow_e = flow + FLOW_E * num_cells;
+  const double* flow_se = flow + FLOW_SE * num_cells;
+  const double* flow_s = flow + FLOW_S * num_cells;
+  const double* flow_sw = flow + FLOW_SW * num_cells;
+  double* delta = &m_delta[0];
+  
+  const int row = y * world_x;
+  for (int i = row + x_begin; i < row + x_end; i++) {
+    double d = delta[i];
+    d += flow_se[i - world_x - 1];
+    d += flow_s[i - world_x];
+    d += flow_sw[i - world_x + 1];
+    d += flow_e[i - 1];
+    d -= flow_e[i];
+    d -= flow_se[i];
+    d -= flow_s[i];
+    d -= flow_sw[i];
+    delta[i] = d;
+  }
+}
+
+void cSpatialResCount::gatherFlows(int row_begin, int row_end)
+{
+  if (!hasInteriorStencil()) return;
+  for (int y = Apto::Max(row_begin, 1); y < row_end; y++) gatherFlowRow(y, 1, world_x - 1);
+}
+
+/* ...and into the border cells, which follow their precomputed term lists */
+
+void cSpatialResCount::gatherEdgeFlows()
+{
+  const double* flow = &m_flow[0];
+  double* delta = &m_delta[0];
+  
+  for (int slot = 0; slot < m_edge_cells.GetSize(); slot++) {
+    const Apto::Array<int>& terms = m_edge_terms[slot];
+    const int cell_id = m_edge_cells[slot];
+    double d = delta[cell_id];
+    for (int t = 0; t < terms.GetSize(); t++) {
+      if (terms[t] & 1) d -= flow[terms[t] >> 1];
+      else d += flow[terms[t] >> 1];
+    }
+    delta[cell_id] = d;
+    if (d != 0.0) markCell(cell_id);
+  }
+}
+
+
+/* Flow between two cells that are both empty is exactly zero, so when only a
+   small part of the grid holds resource, flows are computed just around the
+   active spans.  Every other flow entry is kept at zero (m_flow_lo/hi record
+   where a row may still hold stale values), so the gather stencil can be
+   applied anywhere without seeing a previous step's flows. */
+
+void cSpatialResCount::sparseFlowAll()
+{
+  const bool bounded = (geometry == nGeometry::GRID);
+  
+  for (int y = 0; y < world_y; y++) {
+    const int y_down = (y + 1) % world_y;
+    int lo = m_active_lo[y];
+    int hi = m_active_hi[y];
+    if (!bounded || y < world_y - 1) {
+      lo = Apto::Min(lo, m_active_lo[y_down]);
+      hi = Apto::Max(hi, m_active_hi[y_down]);
+    }
+    
+    if (lo <= hi) {
+      lo--;
+      hi++;
+      if (lo < 0 || hi >= world_x) {
+        if (bounded) {
+          lo = Apto::Max(lo, 0);
+          hi = Apto::Min(hi, world_x - 1);
+        } else {
+          lo = 0;
+          hi = world_x - 1;
+        }
       }
+      calcFlowRow(y, lo, hi + 1);
     }
+    
+    // Clear whatever part of the last step's flows this step did not overwrite
+    const int row = y * world_x;
+    for (int x = m_flow_lo[y]; x <= m_flow_hi[y]; x++) {
+      if (x >= lo && x <= hi) continue;
+      for (int dir = 0; dir < NUM_FLOW_DIRS; dir++) m_flow[dir * num_cells + row + x] = 0.0;
+    }
+    m_flow_lo[y] = lo;
+    m_flow_hi[y] = hi;
   }
+  
+  if (hasInteriorStencil()) {
+    for (int y = 1; y < world_y; y++) {
+      const int lo = Apto::Max(Apto::Min(m_flow_lo[y - 1], m_flow_lo[y]) - 1, 1);
+      const int hi = Apto::Min(Apto::Max(m_flow_hi[y - 1], m_flow_hi[y]) + 1, world_x - 2);
+      if (lo > hi) continue;
+      gatherFlowRow(y, lo, hi + 1);
+      if (lo < m_active_lo[y]) m_active_lo[y] = lo;
+      if (hi > m_active_hi[y]) m_active_hi[y] = hi;
+    }
+  }
+  gatherEdgeFlows();
+}
+
+
+/* Splits calcFlows() or gatherFlows() into row stripes for a worker pool.  Each
+   stripe writes only its own rows, so the result is the same for any number of
+   stripes. */
+
+class cSpatialResCount::cFlowStripeJob : public cWorkerPool::cJob
+{
+private:
+  cSpatialResCount& m_res;
+  int m_num_stripes;
+  bool m_gather;
+  
+public:
+  cFlowStripeJob(cSpatialResCount& res, int num_stripes, bool gather)
+    : m_res(res), m_num_stripes(num_stripes), m_gather(gather) { ; }
+  
+  void Run(int stripe)
+  {
+    const int row_begin = stripe * m_res.world_y / m_num_stripes;
+    const int row_end = (stripe + 1) * m_res.world_y / m_num_stripes;
+    if (m_gather) m_res.gatherFlows(row_begin, row_end);
+    else m_res.calcFlows(row_begin, row_end);
+  }
+};
+
+
+void cSpatialResCount::FlowAll(cWorkerPool* pool) {
+
+  // @JEB save time if diffusion and gravity off...
+  if ((xdiffuse == 0.0) && (ydiffuse == 0.0) && (xgravity == 0.0) && (ygravity == 0.0)) return;
+  if (num_cells == 0) return;
+
+  // Use the sparse path while little of the grid is active
+  int active_cells = 0;
+  for (int y = 0; y < world_y; y++) {
+    if (m_active_lo[y] <= m_active_hi[y]) active_cells += m_active_hi[y] - m_active_lo[y] + 1;
+  }
+  if (active_cells <= num_cells * SPARSE_MAX_OCCUPANCY) {
+    sparseFlowAll();
+    return;
+  }
+  
+  if (pool && pool->GetNumThreads() > 1 && num_cells >= PARALLEL_FLOW_CELLS) {
+    const int num_stripes = Apto::Min(world_y, pool->GetNumThreads() * 4);
+    cFlowStripeJob calc_job(*this, num_stripes, false);
+    pool->Execute(calc_job, num_stripes);
+    cFlowStripeJob gather_job(*this, num_stripes, true);
+    pool->Execute(gather_job, num_stripes);
+  } else {
+    calcFlows(0, world_y);
+    gatherFlows(0, world_y);
+  }
+  gatherEdgeFlows();
+  
+  // Every flow entry now holds this step's value, and any cell may have been reached
+  m_flow_lo.SetAll(0);
+  m_flow_hi.SetAll(world_x - 1);
+  markAll();
 }
 
 /* Total up all the resources in each cell */
 
 double cSpatialResCount::SumAll() const{
-
-  int i;
   double sum = 0.0;
-
-  for (i = 0; i < num_cells; i++) {
-    sum += GetAmount(i);
-  } 
+  for (int i = 0; i < num_cells; i++) sum += m_amount[i];
   return sum;
 }
 
@@ -356,16 +689,20 @@ double cSpatialResCount::SumAll() const{
    inflow rectange */
 
 void cSpatialResCount::Source(double amount) const {
-  int     i, j, elem;
   double  totalcells;
 
   totalcells = (inflowY2 - inflowY1 + 1) * (inflowX2 - inflowX1 + 1) * 1.0;
   amount /= totalcells;
 
-  for (i = inflowY1; i <= inflowY2; i++) {
-    for (j = inflowX1; j <= inflowX2; j++) {
-      elem = (Mod(i,world_y) * world_x) + Mod(j,world_x);
-      Rate(elem,amount); 
+  double* delta = &m_delta[0];
+  for (int i = inflowY1; i <= inflowY2; i++) {
+    const int y = Mod(i, world_y);
+    double* row = delta + y * world_x;
+    for (int j = inflowX1; j <= inflowX2; j++) {
+      const int x = Mod(j, world_x);
+      row[x] += amount;
+      if (x < m_active_lo[y]) m_active_lo[y] = x;
+      if (x > m_active_hi[y]) m_active_hi[y] = x;
     }
   }
 }
@@ -379,7 +716,7 @@ void cSpatialResCount::CellInflow() const {
     /* Be sure the user entered a valid cell id or if the the program is loading
        the resource for the testCPU that does not have a grid set up */
        
-    if (cell_id >= 0 && cell_id < grid.GetSize()) {
+    if (cell_id >= 0 && cell_id < num_cells) {
       Rate(cell_id, (*cell_list_ptr)[i].GetInflow());
     }
   }
@@ -389,16 +726,22 @@ void cSpatialResCount::CellInflow() const {
 
 void cSpatialResCount::Sink(double decay) const {
 
-  int     i, j, elem;
-  double  deltaamount;
-
   if (outflowX1 == cResource::NONE || outflowY1 == cResource::NONE || outflowX2 == cResource::NONE || outflowY2 == cResource::NONE) return;
   
-  for (i = outflowY1; i <= outflowY2; i++) {
-    for (j = outflowX1; j <= outflowX2; j++) {
-      elem = (Mod(i,world_y) * world_x) + Mod(j,world_x);
-      deltaamount = Apto::Max((GetAmount(elem) * (1.0 - decay)), 0.0);
-      Rate(elem,-deltaamount); 
+  const double* amount = &m_amount[0];
+  double* delta = &m_delta[0];
+  for (int i = outflowY1; i <= outflowY2; i++) {
+    // Empty cells lose nothing, so only the active span of each row matters
+    const int y = Mod(i, world_y);
+    const int lo = m_active_lo[y];
+    const int hi = m_active_hi[y];
+    if (lo > hi) continue;
+    
+    const int row = y * world_x;
+    for (int j = outflowX1; j <= outflowX2; j++) {
+      const int x = Mod(j, world_x);
+      if (x < lo || x > hi) continue;
+      delta[row + x] -= Apto::Max((amount[row + x] * (1.0 - decay)), 0.0);
     }
   }
 }
@@ -415,7 +758,7 @@ void cSpatialResCount::CellOutflow() const {
     /* Be sure the user entered a valid cell id or if the the program is loading
        the resource for the testCPU that does not have a grid set up */
        
-    if (cell_id >= 0 && cell_id < grid.GetSize()) {
+    if (cell_id >= 0 && cell_id < num_cells) {
       deltaamount = Apto::Max((GetAmount(cell_id) * (*cell_list_ptr)[i].GetOutflow()), 0.0);
     }                     
     Rate((*cell_list_ptr)[i].GetId(), -deltaamount); 
@@ -424,14 +767,16 @@ void cSpatialResCount::CellOutflow() const {
 
 void cSpatialResCount::SetCellAmount(int cell_id, double res)
 {
-  if (cell_id >= 0 && cell_id < grid.GetSize())
+  if (cell_id >= 0 && cell_id < num_cells)
   {
-    Element(cell_id).SetAmount(res);
+    m_amount[cell_id] = res;
+    markCell(cell_id);
   }
 }
 
 
 void cSpatialResCount::ResetResourceCounts()
 {
-  for (int i = 0; i < grid.GetSize(); i++) grid[i].ResetResourceCount(m_initial);
+  for (int i = 0; i < num_cells; i++) m_amount[i] = m_initial + m_cell_initial[i];
+  if (num_cells > 0) markAll();
 }
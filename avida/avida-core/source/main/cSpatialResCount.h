@@ -26,19 +26,48 @@
 #define cSpatialResCount_h
 
 #include "cAvidaContext.h"
-#include "cSpatialCountElem.h"
 #include "cResource.h"
 
+class cWorkerPool;
+
 
 class cSpatialResCount
 {
-
+public:
+  // Flow directions processed for each cell.  Flow is two way, so only the east and south half of the neighborhood
+  // is computed from each cell; the other half arrives as the neighbor's flow.
+  enum eFlowDir { FLOW_E = 0, FLOW_SE, FLOW_S, FLOW_SW, NUM_FLOW_DIRS };
+  
+  // Grids smaller than this are not worth splitting across threads in FlowAll()
+  static const int PARALLEL_FLOW_CELLS = 16384;
+  // FlowAll() only works around the active cells while they cover at most this fraction of the grid
+  static const double SPARSE_MAX_OCCUPANCY;
+  
 private:
-
+  // Grid state is kept as flat per-cell arrays so that the per-update passes are straight loops over memory
+  mutable Apto::Array<double> m_amount;
+  mutable Apto::Array<double> m_delta;
+  Apto::Array<double> m_cell_initial;
   
+  // Per-direction flow out of each cell for the current step, indexed [dir * num_cells + cell]
+  Apto::Array<double> m_flow;
+  
+  // Per row, the span of cells [lo, hi] that may hold a non-zero amount or delta (empty when lo > hi), and the span
+  // of m_flow that may hold non-zero flows.  Everything outside them is exactly zero.
+  mutable Apto::Array<int> m_active_lo;
+  mutable Apto::Array<int> m_active_hi;
+  Apto::Array<int> m_flow_lo;
+  Apto::Array<int> m_flow_hi;
+  
+  // Cells on the grid border (and every cell of degenerate grids) cannot use the fixed interior stencil when
+  // gathering flows.  Each gets an explicit term list, in the order the contributions must be summed; a term
+  // encodes (flow index << 1) | outgoing, and they are rebuilt by SetPointers().
+  Apto::Array<int> m_edge_slot;
+  Apto::Array<int> m_edge_cells;
+  Apto::Array<Apto::Array<int> > m_edge_terms;
   
-  Apto::Array<cSpatialCountElem> grid;
   double m_initial;
+  double m_epsilon;
   double xdiffuse, ydiffuse;
   double xgravity, ygravity;
   int    inflowX1, inflowX2, inflowY1, inflowY2;
@@ -50,6 +79,24 @@ private:
   Apto::Array<cCellResource> *cell_list_ptr;
   bool m_modified;
   
+  int flowNeighbor(int cell_id, int dir) const;
+  bool hasInteriorStencil() const { return world_x >= 3 && world_y >= 2; }
+  inline void markCell(int cell_id) const;
+  void markAll() const;
+  void trimRow(int y);
+  void calcFlowRow(int y, int x_begin, int x_end);
+  void calcFlows(int row_begin, int row_end);
+  void gatherFlowRow(int y, int x_begin, int x_end);
+  void gatherFlows(int row_begin, int row_end);
+  void gatherEdgeFlows();
+  void sparseFlowAll();
+  
+  class cFlowStripeJob;
+  
+protected:
+  void ClearRowRange(int y, int x_lo, int x_hi);
+  void TrimActiveSpans();
+  
 public:
   cSpatialResCount();
   cSpatialResCount(int inworld_x, int inworld_y, int ingeometry);
@@ -62,11 +109,10 @@ public:
   void SetPointers();
   void CheckRanges();
   void SetCellList(Apto::Array<cCellResource> *in_cell_list_ptr);
-  int GetSize() const { return grid.GetSize(); }
+  int GetSize() const { return num_cells; }
   int GetX() const { return world_x; }
   int GetY() const { return world_y; }
   int GetCellListSize() const { return cell_list_ptr->GetSize(); }
-  cSpatialCountElem& Element(int x) { return grid[x]; }
   void Rate(int x, double ratein) const;
   void Rate(int x, int y, double ratein) const;
   void State(int x);
@@ -75,7 +121,7 @@ public:
   double GetAmount(int x, int y) const;
   void RateAll(double ratein); 
   virtual void StateAll();
-  void FlowAll(); 
+  void FlowAll(cWorkerPool* pool = NULL);
   double SumAll() const;
   void Source(double amount) const;
   void CellInflow() const;
@@ -83,6 +129,7 @@ public:
   void CellOutflow() const;
   void SetCellAmount(int cell_id, double res);
   void SetInitial(double initial) { m_initial = initial; }
+  void SetEpsilon(double epsilon) { m_epsilon = epsilon; }
   double GetInitial() const { return m_initial; }
   void SetGeometry(int in_geometry) { geometry = in_geometry; }
   void SetXdiffuse(double in_xdiffuse) { xdiffuse = in_xdiffuse; }
@@ -98,6 +145,9 @@ public:
   void SetOutflowY1(int in_outflowY1) { outflowY1 = in_outflowY1; }
   void SetOutflowY2(int in_outflowY2) { outflowY2 = in_outflowY2; }
   virtual void UpdateCount(cAvidaContext&) { ; }
+  // Resources whose UpdateCount() draws on the context (random numbers, world state) must be updated serially, in
+  // resource order; all others may be updated concurrently with each other.
+  virtual bool RequiresSerialUpdate() const { return false; }
   void ResetResourceCounts();
   void SetModified(bool in_modified) { m_modified = in_modified; }
   bool GetModified() { return m_modified; }
@@ -37,6 +37,7 @@
 #include "cPopulationCell.h"
 #include "cDeme.h"
 #include "cMigrationMatrix.h"
+#include "cOrgStatTotals.h"
 #include "cStringUtil.h"
 #include "cWorld.h"
 #include "tDataEntry.h"
@@ -127,6 +128,7 @@ cStats::cStats(cWorld* world)
   task_last_count.Resize(num_tasks);
   task_test_count.Resize(num_tasks);
   m_collect_env_test_stats = false;
+  m_org_stats_required = false;
   
   tasks_host_current.Resize(num_tasks);
   tasks_host_last.Resize(num_tasks);
@@ -499,6 +501,56 @@ void cStats::ZeroReactions()
   m_reaction_last_add_reward.SetAll(0);
 }
 
+void cStats::AddOrgStatTotals(const cOrgStatTotals& totals)
+{
+  sum_fitness.Merge(totals.fitness);
+  sum_merit.Merge(totals.merit);
+  sum_gestation.Merge(totals.gestation);
+  sum_creature_age.Merge(totals.creature_age);
+  sum_generation.Merge(totals.generation);
+  sum_neutral_metric.Merge(totals.neutral_metric);
+  sum_lineage_label.Merge(totals.lineage_label);
+  sum_copy_size.Merge(totals.copy_size);
+  sum_exe_size.Merge(totals.exe_size);
+  sum_mem_size.Merge(totals.mem_size);
+  sum_copy_mut_rate.Merge(totals.copy_mut_rate);
+  sum_log_copy_mut_rate.Merge(totals.log_copy_mut_rate);
+  sum_div_mut_rate.Merge(totals.div_mut_rate);
+  sum_log_div_mut_rate.Merge(totals.log_div_mut_rate);
+  
+  for (int j = 0; j < totals.task_cur_count.GetSize(); j++) {
+    task_cur_count[j] += totals.task_cur_count[j];
+    task_cur_quality[j] += totals.task_cur_quality[j];
+    if (totals.task_cur_max_quality[j] > task_cur_max_quality[j]) task_cur_max_quality[j] = totals.task_cur_max_quality[j];
+    task_last_count[j] += totals.task_last_count[j];
+    task_last_quality[j] += totals.task_last_quality[j];
+    if (totals.task_last_max_quality[j] > task_last_max_quality[j]) task_last_max_quality[j] = totals.task_last_max_quality[j];
+    task_exe_count[j] += totals.task_exe_count[j];
+    tasks_host_current[j] += totals.host_task_cur_count[j];
+    tasks_host_last[j] += totals.host_task_last_count[j];
+    tasks_parasite_current[j] += totals.parasite_task_cur_count[j];
+    tasks_parasite_last[j] += totals.parasite_task_last_count[j];
+    task_internal_cur_count[j] += totals.internal_task_cur_count[j];
+    task_internal_cur_quality[j] += totals.internal_task_cur_quality[j];
+    if (totals.internal_task_cur_max_quality[j] > task_internal_cur_max_quality[j]) {
+      task_internal_cur_max_quality[j] = totals.internal_task_cur_max_quality[j];
+    }
+    task_internal_last_count[j] += totals.internal_task_last_count[j];
+    task_internal_last_quality[j] += totals.internal_task_last_quality[j];
+    if (totals.internal_task_last_max_quality[j] > task_internal_last_max_quality[j]) {
+      task_internal_last_max_quality[j] = totals.internal_task_last_max_quality[j];
+    }
+  }
+  
+  for (int j = 0; j < totals.reaction_cur_count.GetSize(); j++) {
+    m_reaction_cur_count[j] += totals.reaction_cur_count[j];
+    m_reaction_cur_add_reward[j] += totals.reaction_cur_add_reward[j];
+    m_reaction_last_count[j] += totals.reaction_last_count[j];
+    m_reaction_last_add_reward[j] += totals.reaction_last_add_reward[j];
+    m_reaction_exe_count[j] += totals.reaction_exe_count[j];
+  }
+}
+
 void cStats::ZeroMessageInst()
 {
 
@@ -628,6 +680,25 @@ void cStats::ProcessUpdate()
   m_num_successful_mates = 0;
 }
 
+bool cStats::ShouldCollectOrgStats() const
+{
+  if (!m_world->GetConfig().STATS_ON_DEMAND.Get() || m_org_stats_required) return true;
+  
+  // Events are processed before the next update begins, reading the stats gathered at the end of this one
+  if (m_world->GetEventsList()->HasEventDue(m_update)) return true;
+  
+  // Active data providers are read by their recorders once this update is complete
+  Data::ManagerPtr manager = Data::Manager::Of(m_world->GetNewWorld());
+  for (Apto::Map<Apto::String, ProvidedData>::KeyIterator it = m_provided_data.Keys(); it.Next();) {
+    if (manager->IsActive(*it.Get())) return true;
+  }
+  
+  // The population's organism stat providers are filled by the same pass
+  if (m_world->GetPopulation().HasActiveOrgStatProvider()) return true;
+  
+  return false;
+}
+
 int cStats::GetNumPreyCreatures() const
 {
   return m_world->GetPopulation().GetNumPreyOrganisms();
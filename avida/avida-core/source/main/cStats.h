@@ -54,6 +54,7 @@
 class cWorld;
 class cOrganism;
 class cOrgMessage;
+class cOrgStatTotals;
 class cOrgMessagePredicate;
 class cOrgMovementPredicate;
 class cDeme;
@@ -241,6 +242,7 @@ private:
 
   // --------  Organism Task Stats  ---------
   mutable bool m_collect_env_test_stats;
+  bool m_org_stats_required;
   Apto::Array<int> task_cur_count;
   Apto::Array<int> task_last_count;
   Apto::Array<int> task_test_count;
@@ -671,6 +673,11 @@ public:
   void AddLastParasiteTask(int task_num) { tasks_parasite_last[task_num]++; }
   
   bool ShouldCollectEnvTestStats() const { return m_collect_env_test_stats; }
+  
+  // Drivers that read the organism stats after every update (viewers, detailed progress output) register here;
+  // otherwise, with STATS_ON_DEMAND, they are only gathered when an event or data recorder will use them.
+  void RequireOrgStats() { m_org_stats_required = true; }
+  bool ShouldCollectOrgStats() const;
 
   void AddLastTaskQuality(int task_num, double quality)
   {
@@ -709,6 +716,7 @@ public:
   void AddLastReactionAddReward(int reaction, double reward) { m_reaction_last_add_reward[reaction] += reward; }
   void IncReactionExeCount(int reaction, int count) { m_reaction_exe_count[reaction] += count; }
   void ZeroReactions();
+  void AddOrgStatTotals(const cOrgStatTotals& totals);
 
   void SetResources(const Apto::Array<double> &_in) { resource_count = _in; }
   void SetResourcesGeometry(const Apto::Array<int> &_in) { resource_geometry = _in;}
@@ -27,6 +27,7 @@
 #include "tList.h"
 
 class cTaskEntry;
+class cLogicIdentifier;
 class cTaskState;
 
 
@@ -41,6 +42,7 @@ private:
   const Apto::Array<int, Apto::Smart>& m_ext_mem;
   tBuffer<int>* m_received_messages;
   int m_logic_id;
+  cLogicIdentifier* m_logic_ident;
   bool m_on_divide;
 
   // for optimize tasks actual value of function org is outputting, for all others nothing
@@ -64,6 +66,7 @@ public:
     , m_ext_mem(ext_mem)
     , m_received_messages(in_received_messages)
     , m_logic_id(0)
+    , m_logic_ident(NULL)
     , m_on_divide(in_on_divide)
     , m_task_entry(NULL)
     , m_task_states(NULL)
@@ -80,6 +83,8 @@ public:
   inline tBuffer<int>* GetReceivedMessages() { return m_received_messages; }
   inline int GetLogicId() const { return m_logic_id; }
   inline void SetLogicId(int v) { m_logic_id = v; }
+  inline cLogicIdentifier* GetLogicIdentifier() { return m_logic_ident; }
+  inline void SetLogicIdentifier(cLogicIdentifier* ident) { m_logic_ident = ident; }
   inline bool GetOnDivide() const { return m_on_divide; }
   inline void SetTaskValue(double v) { m_task_value = v; }
   inline double GetTaskValue() { return m_task_value; }
@@ -44,10 +44,12 @@ private:
   cArgContainer* m_args;
   Apto::String m_prop_id_ave;
   Apto::String m_prop_id_count;
+  bool m_logic_only;               // Test result depends only on the logic id of the output
+  Apto::Array<int> m_logic_ids;    // ...in which case, these are the logic ids that trigger it
 
 public:
   cTaskEntry(const cString& name, const cString& desc, int in_id, tTaskTest fun, cArgContainer* args)
-    : m_name(name), m_desc(desc), m_id(in_id), m_test_fun(fun), m_args(args)
+    : m_name(name), m_desc(desc), m_id(in_id), m_test_fun(fun), m_args(args), m_logic_only(false)
   {
     m_prop_id_ave = Apto::FormatStr("environment.triggers.%s.average", (const char*)name);
     m_prop_id_count = Apto::FormatStr("environment.triggers.%s.count", (const char*)name);
@@ -62,6 +64,10 @@ public:
   int GetID() const { return m_id; }
   tTaskTest GetTestFun() const { return m_test_fun; }
   
+  bool IsLogicOnly() const { return m_logic_only; }
+  const Apto::Array<int>& GetLogicIds() const { return m_logic_ids; }
+  void SetLogicIds(const Apto::Array<int>& logic_ids) { m_logic_only = true; m_logic_ids = logic_ids; }
+  
   const Apto::String& AveragePropertyID() const { return m_prop_id_ave; }
   const Apto::String& CountPropertyID() const { return m_prop_id_count; }
   
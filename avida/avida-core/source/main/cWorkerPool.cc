@@ -0,0 +1,114 @@
+/*
+ *  cWorkerPool.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cWorkerPool.h"
+
+
+cWorkerPool::cWorkerPool(int num_threads)
+  : m_job(NULL), m_num_items(0), m_next_item(0), m_completed(0), m_generation(0), m_shutdown(false)
+{
+  if (num_threads < 1) num_threads = 1;
+  m_workers.Resize(num_threads - 1);
+  for (int i = 0; i < m_workers.GetSize(); i++) {
+    m_workers[i] = new cWorker(this);
+    m_workers[i]->Start();
+  }
+}
+
+cWorkerPool::~cWorkerPool()
+{
+  m_mutex.Lock();
+  m_shutdown = true;
+  m_mutex.Unlock();
+  m_cond.Broadcast();
+  
+  for (int i = 0; i < m_workers.GetSize(); i++) {
+    m_workers[i]->Join();
+    delete m_workers[i];
+  }
+}
+
+
+void cWorkerPool::Execute(cJob& job, int num_items)
+{
+  if (m_workers.GetSize() == 0 || num_items < 2) {
+    for (int i = 0; i < num_items; i++) job.Run(i);
+    return;
+  }
+  
+  m_mutex.Lock();
+  m_job = &job;
+  m_num_items = num_items;
+  m_next_item = 0;
+  m_completed = 0;
+  m_generation++;
+  m_mutex.Unlock();
+  m_cond.Broadcast();
+  
+  runItems();
+  
+  m_mutex.Lock();
+  while (m_completed < m_num_items) m_done_cond.Wait(m_mutex);
+  m_job = NULL;
+  m_num_items = 0;
+  m_mutex.Unlock();
+}
+
+
+void cWorkerPool::runItems()
+{
+  while (true) {
+    m_mutex.Lock();
+    if (m_next_item >= m_num_items) {
+      m_mutex.Unlock();
+      return;
+    }
+    cJob* job = m_job;
+    const int item = m_next_item++;
+    m_mutex.Unlock();
+    
+    job->Run(item);
+    
+    m_mutex.Lock();
+    const bool done = (++m_completed == m_num_items);
+    m_mutex.Unlock();
+    if (done) m_done_cond.Signal();
+  }
+}
+
+
+void cWorkerPool::cWorker::Run()
+{
+  int seen_generation = 0;
+  
+  m_pool->m_mutex.Lock();
+  while (true) {
+    while (!m_pool->m_shutdown && m_pool->m_generation == seen_generation) m_pool->m_cond.Wait(m_pool->m_mutex);
+    if (m_pool->m_shutdown) break;
+    seen_generation = m_pool->m_generation;
+    m_pool->m_mutex.Unlock();
+    
+    m_pool->runItems();
+    
+    m_pool->m_mutex.Lock();
+  }
+  m_pool->m_mutex.Unlock();
+}
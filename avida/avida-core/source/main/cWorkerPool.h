@@ -0,0 +1,84 @@
+/*
+ *  cWorkerPool.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cWorkerPool_h
+#define cWorkerPool_h
+
+#include "apto/core.h"
+
+
+// A fixed set of worker threads for splitting work inside an update into independent items.  Execute() hands out the
+// items of one job to the workers and the calling thread, and returns once every item has completed.  Jobs must only
+// touch per-item state (or state they synchronize themselves); as long as they do, results do not depend on how many
+// threads the pool has.
+
+class cWorkerPool
+{
+public:
+  class cJob
+  {
+  public:
+    virtual ~cJob() { ; }
+    virtual void Run(int item) = 0;
+  };
+  
+private:
+  class cWorker : public Apto::Thread
+  {
+  private:
+    cWorkerPool* m_pool;
+    
+    void Run();
+    
+  public:
+    cWorker(cWorkerPool* pool) : m_pool(pool) { ; }
+  };
+  
+  Apto::Array<cWorker*> m_workers;
+  Apto::Mutex m_mutex;
+  Apto::ConditionVariable m_cond;
+  Apto::ConditionVariable m_done_cond;
+  
+  cJob* m_job;
+  int m_num_items;
+  int m_next_item;
+  int m_completed;
+  int m_generation;
+  bool m_shutdown;
+  
+  void runItems();
+  
+  
+  cWorkerPool(); // @not_implemented
+  cWorkerPool(const cWorkerPool&); // @not_implemented
+  cWorkerPool& operator=(const cWorkerPool&); // @not_implemented
+  
+public:
+  cWorkerPool(int num_threads);
+  ~cWorkerPool();
+  
+  // Total threads working a job, counting the caller of Execute()
+  int GetNumThreads() const { return m_workers.GetSize() + 1; }
+  
+  void Execute(cJob& job, int num_items);
+};
+
+#endif
@@ -52,7 +52,7 @@ using namespace AvidaTools;
 cWorld::cWorld(cAvidaConfig* cfg, const cString& wd)
   : m_working_dir(wd), m_analyze(NULL), m_conf(cfg), m_ctx(NULL)
   , m_env(NULL), m_event_list(NULL), m_hw_mgr(NULL), m_pop(NULL), m_stats(NULL), m_mig_mat(NULL), m_driver(NULL), m_data_mgr(NULL)
-  , m_own_driver(false), control(), before_repro_sig("before-repro", control)
+  , m_eval_seed(0), m_own_driver(false), control(), before_repro_sig("before-repro", control)
   , offspring_ready_sig("offspring-ready", control), inject_ready_sig("inject-ready", control)
   , org_placement_sig("org-placement", control), on_update_sig("on-update", control)
   , org_death_sig("on-death", control), oee_file("oee.csv"), phylodiversity_file("phylodiversity.csv"), lineage_file("lineage.csv"), dom_file("dominant.csv")
@@ -70,15 +70,17 @@ cWorld::cWorld(cAvidaConfig* cfg, const cString& wd)
       return test_info.GetGenotypeFitness();
    };
 
-    eval_fun = [this](emp::Ptr<taxon_t> tax){
-
-       Avida::Genome gen(curr_genome.HardwareType(), curr_genome.Properties(), GeneticRepresentationPtr(new InstructionSequence(tax->GetInfo())));
+    eval_fun = [this](emp::Ptr<taxon_t> tax, const Genome& gen){
+      // Seed from the taxon alone, so a taxon's result does not depend on which others were tested before it
+      const long long max_seed = m_eval_rng.MaxSeed();
+      m_eval_rng.ResetSeed(int(1 + (m_eval_seed + (long long)(tax->GetID() % max_seed)) % (max_seed - 1)));
+      cAvidaContext ctx(m_driver, m_eval_rng);
       //  cAnalyzeGenotype genotype(this, gen);
-      //  genotype.Recalculate(*m_ctx);
+      //  genotype.Recalculate(ctx);
       cCPUTestInfo test_info;
-      cTestCPU* test_cpu = GetHardwareManager().CreateTestCPU(*m_ctx);
+      cTestCPU* test_cpu = GetHardwareManager().CreateTestCPU(ctx);
       // test_info.UseManualInputs(curr_target_cell.GetInputs()); // Test using what the environment will be
-      test_cpu->TestGenome(*m_ctx, test_info, gen);  // Use the true genome
+      test_cpu->TestGenome(ctx, test_info, gen);  // Use the true genome
       delete test_cpu;
       tax->GetData().RecordFitness(test_info.GetGenotypeFitness());
       Phenotype p;
@@ -143,6 +145,7 @@ bool cWorld::setup(World* new_world, cUserFeedback* feedback, const Apto::Map<Ap
   // Setup Random Number Generator
   m_rng.ResetSeed(m_conf->RANDOM_SEED.Get());
   m_ctx = new cAvidaContext(NULL, m_rng);
+  m_eval_seed = m_rng.GetInt(m_rng.MaxSeed());
 
   // Initialize new API-based data structures here for now
   {
@@ -292,10 +295,15 @@ bool cWorld::setup(World* new_world, cUserFeedback* feedback, const Apto::Map<Ap
     systematics_manager->AddOrg(seq, {next_cell_id, int(false)}, GetStats().GetUpdate());
     emp::Ptr<taxon_t> tax = systematics_manager->GetMostRecent();
     if (tax->GetData().GetPhenotype().gestation_time == -1) {
-      eval_fun(tax);
+      QueueTaxonEval(tax);
     }
   });
   OnOrgDeath([this](int pos){ systematics_manager->RemoveOrgAfterRepro(pos, GetStats().GetUpdate());});
+  std::function<void(emp::Ptr<taxon_t>)> on_prune = [this](emp::Ptr<taxon_t> tax){ dropPendingTaxon(tax); };
+  systematics_manager->OnPrune(on_prune);
+
+  // Registered ahead of the handlers below, so taxon data is complete before any of them reads it
+  OnUpdate([this](int ud){ EvaluatePendingTaxa(); });
   OnUpdate([this](int ud){
     if (std::round(GetStats().GetGeneration()) > latest_gen) {
       latest_gen = std::round(GetStats().GetGeneration());
@@ -446,6 +454,41 @@ int cWorld::GetNumResources()
   return m_env->GetResourceLib().GetSize();
 }
 
+void cWorld::QueueTaxonEval(emp::Ptr<taxon_t> tax)
+{
+  // A taxon already waiting may gain more organisms before it is tested
+  if (m_pending_taxa_idx.count(tax->GetID())) return;
+
+  cPendingTaxon pending;
+  pending.taxon = tax;
+  pending.genome = GenomePtr(new Genome(curr_genome.HardwareType(), curr_genome.Properties(),
+                                        GeneticRepresentationPtr(new InstructionSequence(tax->GetInfo()))));
+  m_pending_taxa_idx[tax->GetID()] = m_pending_taxa.size();
+  m_pending_taxa.push_back(pending);
+}
+
+void cWorld::EvaluatePendingTaxa()
+{
+  for (size_t i = 0; i < m_pending_taxa.size(); i++) eval_fun(m_pending_taxa[i].taxon, *m_pending_taxa[i].genome);
+  m_pending_taxa.clear();
+  m_pending_taxa_idx.clear();
+}
+
+void cWorld::dropPendingTaxon(emp::Ptr<taxon_t> tax)
+{
+  auto it = m_pending_taxa_idx.find(tax->GetID());
+  if (it == m_pending_taxa_idx.end()) return;
+
+  // Move the last entry into the vacated slot; each taxon is seeded on its own, so order does not matter
+  const size_t idx = it->second;
+  m_pending_taxa_idx.erase(it);
+  if (idx != m_pending_taxa.size() - 1) {
+    m_pending_taxa[idx] = m_pending_taxa.back();
+    m_pending_taxa_idx[m_pending_taxa[idx].taxon->GetID()] = idx;
+  }
+  m_pending_taxa.pop_back();
+}
+
 
 void cWorld::SetDriver(WorldDriver* driver, bool take_ownership)
 {
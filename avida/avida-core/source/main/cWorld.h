@@ -45,6 +45,7 @@
 
 #include <array>
 #include <cassert>
+#include <unordered_map>
 
 class cAnalyze;
 class cAnalyzeGenotype;
@@ -93,16 +94,11 @@ namespace std
     template <> struct hash<Avida::InstructionSequence>
     {
         typedef Avida::InstructionSequence argument_type;
-        typedef unsigned int result_type;
+        typedef std::size_t result_type;
         result_type operator()(argument_type const& genome) const
         {
-            unsigned int total = 0;
-
-            for (int i = 0; i < genome.GetSize(); i++) {
-              total += (genome[i].GetOp() + 3) * i;
-            }
-
-            return total % 3203;
+            // cached on the sequence, so the genome is hashed once however many tables look it up
+            return static_cast<result_type>(genome.Fingerprint());
         }
     };
 
@@ -154,6 +150,8 @@ protected:
   Data::ManagerPtr m_data_mgr;
 
   Apto::RNG::AvidaRNG m_rng;
+  Apto::RNG::AvidaRNG m_eval_rng;   // Reseeded per taxon, so evaluations do not draw on the population's generator
+  int m_eval_seed;
 
   bool m_test_on_div;     // flag derived from a collection of configuration settings
   bool m_test_sterilize;  // flag derived from a collection of configuration settings
@@ -220,7 +218,7 @@ public:
   emp::Ptr<taxon_t> mrca_ptr;
   size_t mrca_changes=0;
 
-  std::function<void(emp::Ptr<taxon_t>)> eval_fun;
+  std::function<void(emp::Ptr<taxon_t>, const Genome&)> eval_fun;
   const emp::vector<std::string> MUTATION_TYPES = {"substitution", "insertion", "deletion"};
 
   using mut_count_t = std::unordered_map<std::string, double>;
@@ -267,9 +265,23 @@ public:
 	//! Calculate the size (in virtual CPU cycles) of the current update.
 	virtual int CalculateUpdateSize();
 
+  // New taxa are not tested on the birth path; they wait until the update signal, where the systematics consumers
+  // first read their fitness and phenotype.  Taxa pruned before then are never tested.
+  void QueueTaxonEval(emp::Ptr<taxon_t> tax);
+  void EvaluatePendingTaxa();
+
 protected:
+  struct cPendingTaxon
+  {
+    emp::Ptr<taxon_t> taxon;
+    GenomePtr genome;   // Hardware type and properties of the birth that created the taxon
+  };
+  emp::vector<cPendingTaxon> m_pending_taxa;
+  std::unordered_map<size_t, size_t> m_pending_taxa_idx;   // taxon id -> position in m_pending_taxa
+
   // Internal Methods
   bool setup(World* new_world, cUserFeedback* errors,  const Apto::Map<Apto::String, Apto::String>* mappings);
+  void dropPendingTaxon(emp::Ptr<taxon_t> tax);
 
 };
 
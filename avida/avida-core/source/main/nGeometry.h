@@ -34,7 +34,8 @@ namespace nGeometry {
 		PARTIAL,
 		LATTICE,
 		RANDOM_CONNECTED,
-		SCALE_FREE
+		SCALE_FREE,
+		WELL_MIXED
   };
 }
 
@@ -131,6 +131,7 @@ Avida::Systematics::Genotype::Genotype(GenotypeArbiterPtr mgr, GroupID in_id, Un
   , m_handle(NULL)
   , m_src(founder->UnitSource())
   , m_genome(founder->UnitGenome())
+  , m_fingerprint(0)
   , m_name("001-no_name")
   , m_threshold(false)
   , m_active(true)
@@ -187,6 +188,7 @@ Avida::Systematics::Genotype::Genotype(GenotypeArbiterPtr mgr, GroupID in_id, vo
 : Group(in_id)
 , m_mgr(mgr)
 , m_handle(NULL)
+, m_fingerprint(0)
 , m_name("001-no_name")
 , m_threshold(false)
 , m_active(false)
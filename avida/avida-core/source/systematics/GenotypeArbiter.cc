@@ -40,6 +40,9 @@ Avida::Systematics::GenotypeArbiter::GenotypeArbiter(World* world, const RoleID&
   : Arbiter(role)
   , m_threshold(threshold)
   , m_disable_class(disable_class)
+  , m_active_table(INITIAL_TABLE_SIZE)
+  , m_active_keys(INITIAL_TABLE_SIZE)
+  , m_active_count(0)
   , m_active_sz(1)
   , m_coalescent(NULL)
   , m_best(0)
@@ -86,16 +89,15 @@ void Avida::Systematics::GenotypeArbiter::PerformUpdate(Context&, Update current
 {
   m_cur_update = current_update + 1; // +1 since PerformUpdate happens at end of updates, but m_cur_update is used during
   
-  if (m_active_sz.GetSize() < HASH_SIZE) {
+  if (m_active_sz.GetSize() < m_active_table.GetSize()) {
     for (int i = 0; i < m_active_sz.GetSize(); i++) {
       Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_sz[i].Begin());
       while (list_it.Next() != NULL) if ((*list_it.Get())->IsThreshold()) (*list_it.Get())->UpdateReset();
     }
   } else {
-    for (int i = 0; i < HASH_SIZE; i++) {
-      Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_hash[i].Begin());
-      while (list_it.Next() != NULL) if ((*list_it.Get())->IsThreshold()) (*list_it.Get())->UpdateReset();
-    }    
+    for (int i = 0; i < m_active_table.GetSize(); i++) {
+      if (m_active_table[i] && m_active_table[i]->IsThreshold()) m_active_table[i]->UpdateReset();
+    }
   }
 
   Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_historic.Begin());
@@ -133,6 +135,7 @@ bool Avida::Systematics::GenotypeArbiter::LegacySave(void* dfp) const
 Avida::Systematics::GroupPtr Avida::Systematics::GenotypeArbiter::LegacyLoad(void* props)
 {
   GenotypePtr g(new Genotype(thisPtr(), m_next_id++, props));
+  g->m_fingerprint = fingerprintGenome(g->GroupGenome());
   m_historic.Push(g, &g->m_handle);
   return g;
 }
@@ -283,7 +286,7 @@ Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::ClassifyNew
   ConstInstructionSequencePtr seq;
   seq.DynamicCastFrom(u->UnitGenome().Representation());
   assert(seq);
-  int list_num = hashGenome(*seq);
+  const unsigned long long fingerprint = seq->Fingerprint();
   
   GenotypePtr found;
 
@@ -311,7 +314,7 @@ Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::ClassifyNew
           seq.DynamicCastFrom(found->GroupGenome().Representation());
           assert(seq);
           
-          m_active_hash[hashGenome(*seq)].Push(found);
+          insertActive(found);
           found->m_handle->Remove(); // Remove from historic list
           resizeActiveList(found->NumUnits());
           m_active_sz[found->NumUnits()].PushRear(found, &found->m_handle);
@@ -333,14 +336,8 @@ Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::ClassifyNew
   
   // No hints or unable to locate hinted genome, search for a matching genotype
   if (!found) {
-    Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_hash[list_num].Begin());
-    while (list_it.Next() != NULL) {
-      if ((*list_it.Get())->Matches(u)) {
-        found = *list_it.Get();
-        found->NotifyNewUnit(u);
-        break;
-      }
-    }
+    found = findActive(u, fingerprint);
+    if (found) found->NotifyNewUnit(u);
   }
   
   // No matching genotype (hinted or otherwise), so create a new one
@@ -350,7 +347,8 @@ Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::ClassifyNew
     } else {
       found = GenotypePtr(new Genotype(thisPtr(), m_next_id++, u, m_cur_update, ConstGroupMembershipPtr(NULL)));
     }
-    m_active_hash[list_num].Push(found);
+    found->m_fingerprint = fingerprint;
+    insertActive(found);
     resizeActiveList(found->NumUnits());
     m_active_sz[found->NumUnits()].PushRear(found, &found->m_handle);
     m_tot_genotypes++;
@@ -468,15 +466,71 @@ void Avida::Systematics::GenotypeArbiter::setupProvidedData(World* world)
 
 
 
-unsigned int Avida::Systematics::GenotypeArbiter::hashGenome(const InstructionSequence& genome) const
+unsigned long long Avida::Systematics::GenotypeArbiter::fingerprintGenome(const Genome& genome) const
 {
-  unsigned int total = 0;
-  
-  for (int i = 0; i < genome.GetSize(); i++) {
-    total += (genome[i].GetOp() + 3) * i;
+  ConstInstructionSequencePtr seq;
+  seq.DynamicCastFrom(genome.Representation());
+  assert(seq);
+  return seq->Fingerprint();
+}
+
+
+// Active genotypes live in an open addressing table with linear probing, at most half full.  Genotypes that share a
+// fingerprint (the same genome under different transmission types, or a true collision) sit in the same probe run,
+// so a lookup compares genomes only for entries whose fingerprint matches, and stops at the first empty slot.
+
+Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::findActive(UnitPtr u, unsigned long long fingerprint)
+{
+  const int mask = m_active_table.GetSize() - 1;
+  for (int i = static_cast<int>(fingerprint & mask); m_active_table[i]; i = (i + 1) & mask) {
+    if (m_active_keys[i] == fingerprint && m_active_table[i]->Matches(u)) return m_active_table[i];
+  }
+  return GenotypePtr(NULL);
+}
+
+void Avida::Systematics::GenotypeArbiter::insertActive(GenotypePtr genotype)
+{
+  if (2 * (m_active_count + 1) > m_active_table.GetSize()) resizeActiveTable(2 * m_active_table.GetSize());
+  
+  const int mask = m_active_table.GetSize() - 1;
+  int i = static_cast<int>(genotype->m_fingerprint & mask);
+  while (m_active_table[i]) i = (i + 1) & mask;
+  m_active_table[i] = genotype;
+  m_active_keys[i] = genotype->m_fingerprint;
+  m_active_count++;
+}
+
+void Avida::Systematics::GenotypeArbiter::removeActive(GenotypePtr genotype)
+{
+  const int mask = m_active_table.GetSize() - 1;
+  int gap = static_cast<int>(genotype->m_fingerprint & mask);
+  while (m_active_table[gap] != genotype) {
+    assert(m_active_table[gap]);
+    gap = (gap + 1) & mask;
   }
   
-  return total % HASH_SIZE;
+  // Pull later entries of the probe run back into the gap, unless that would move one before its home slot, so the
+  // table never needs deletion markers
+  for (int i = (gap + 1) & mask; m_active_table[i]; i = (i + 1) & mask) {
+    const int home = static_cast<int>(m_active_keys[i] & mask);
+    if (((i - home) & mask) >= ((i - gap) & mask)) {
+      m_active_table[gap] = m_active_table[i];
+      m_active_keys[gap] = m_active_keys[i];
+      gap = i;
+    }
+  }
+  m_active_table[gap] = GenotypePtr(NULL);
+  m_active_count--;
+}
+
+void Avida::Systematics::GenotypeArbiter::resizeActiveTable(int size)
+{
+  Apto::Array<GenotypePtr> old_table(m_active_table);
+  m_active_table.ResizeClear(size);
+  m_active_table.SetAll(GenotypePtr(NULL));
+  m_active_keys.ResizeClear(size);
+  m_active_count = 0;
+  for (int i = 0; i < old_table.GetSize(); i++) if (old_table[i]) insertActive(old_table[i]);
 }
 
 Apto::String Avida::Systematics::GenotypeArbiter::nameGenotype(int size)
@@ -500,10 +554,7 @@ void Avida::Systematics::GenotypeArbiter::removeGenotype(GenotypePtr genotype)
   if (genotype->ActiveReferenceCount()) return;    
   
   if (genotype->IsActive()) {
-    ConstInstructionSequencePtr seq;
-    seq.DynamicCastFrom(genotype->GroupGenome().Representation());
-    int list_num = hashGenome(*seq);
-    m_active_hash[list_num].Remove(genotype);
+    removeActive(genotype);
     genotype->Deactivate(m_cur_update);
     m_historic.Push(genotype, &genotype->m_handle);
   }
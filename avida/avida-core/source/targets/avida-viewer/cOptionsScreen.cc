@@ -87,6 +87,15 @@ void cOptionsScreen::Draw(cAvidaContext& ctx)
   case SLICE_INTEGRATED_MERIT:
     Print(1, 55, "Integrated");
     break;
+  case SLICE_PROB_MERIT_BATCH:
+    Print(1, 55, "Prob. Batch");
+    break;
+  case SLICE_DEME_BLOCK:
+    Print(1, 55, "Deme Block");
+    break;
+  case SLICE_PROB_MERIT_ORDERED:
+    Print(1, 55, "Prob. Ordered");
+    break;
   }
 
   switch(info.GetConfig().BASE_MERIT_METHOD.Get()) {
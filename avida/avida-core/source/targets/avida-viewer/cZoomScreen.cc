@@ -505,7 +505,8 @@ void cZoomScreen::UpdateStats(cHardwareBase& hardware)
         info.GetActiveID() / population.GetWorldY());
   
   // Now show the location of the CPU we are facing.
-  int id = info.GetActiveCell()->ConnectionList().GetFirst()->GetID();
+  if (info.GetActiveCell()->GetNumNeighbors() == 0) return;
+  int id = info.GetActiveCell()->GetCellFaced().GetID();
   Print(2, 40, "[%2d, %2d] ",
         id % population.GetWorldX(), id / population.GetWorldY());
   
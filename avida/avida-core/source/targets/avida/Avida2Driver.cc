@@ -29,6 +29,7 @@
 #include "avida/systematics/Group.h"
 
 #include "cAnalyze.h"
+#include "cAnalyzeMultiRun.h"
 #include "cAvidaContext.h"
 #include "cHardwareBase.h"
 #include "cHardwareManager.h"
@@ -65,6 +66,13 @@ void Avida2Driver::Run()
 {
   if (m_world->GetConfig().ANALYZE_MODE.Get() > 0) {
     cout << "In analyze mode!!" << endl;
+    if (m_world->GetConfig().ANALYZE_RUN_LIST.Get() != "") {
+      cAnalyzeMultiRun multirun(m_world);
+      if (multirun.LoadRunList(m_world->GetConfig().ANALYZE_RUN_LIST.Get())) {
+        multirun.Run(m_world->GetConfig().ANALYZE_FILE.Get());
+      }
+      return;
+    }
     cAnalyze& analyze = m_world->GetAnalyze();
     analyze.RunFile(m_world->GetConfig().ANALYZE_FILE.Get());
     if (m_world->GetConfig().ANALYZE_MODE.Get() == 2) analyze.RunInteractive();
@@ -74,6 +82,9 @@ void Avida2Driver::Run()
   cPopulation& population = m_world->GetPopulation();
   cStats& stats = m_world->GetStats();
   
+  // Detailed progress output includes thread and parasite counts each update
+  if (m_world->GetVerbosity() == VERBOSE_ON || m_world->GetVerbosity() == VERBOSE_DETAILS) stats.RequireOrgStats();
+  
   const double point_mut_prob = m_world->GetConfig().POINT_MUT_PROB.Get() +
                                 m_world->GetConfig().POINT_INS_PROB.Get() +
                                 m_world->GetConfig().POINT_DEL_PROB.Get() +
@@ -312,6 +312,997 @@ protected:
 };
 
 
+#include "cLogicIdentifier.h"
+class cLogicIdentifierTests : public cUnitTest
+{
+public:
+  const char* GetUnitName() { return "cLogicIdentifier"; }
+protected:
+  // Original bit-at-a-time identification from cTaskLib::SetupTests
+  static int ReferenceLogicId(const int* inputs, int num_inputs, int test_output)
+  {
+    int test_inputs[3];
+    for (int i = 0; i < 3; i++) test_inputs[i] = (num_inputs > i) ? inputs[i] : 0;
+    
+    int logic_out[8];
+    for (int i = 0; i < 8; i++) logic_out[i] = -1;
+    for (int test_pos = 0; test_pos < 32; test_pos++) {
+      int logic_pos = 0;
+      for (int i = 0; i < 3; i++) logic_pos += (test_inputs[i] & 1) << i;
+      if (logic_out[logic_pos] != -1 && logic_out[logic_pos] != (test_output & 1)) return -1;
+      logic_out[logic_pos] = test_output & 1;
+      test_output >>= 1;
+      for (int i = 0; i < 3; i++) test_inputs[i] >>= 1;
+    }
+    
+    if (num_inputs < 1) logic_out[1] = logic_out[0];
+    if (num_inputs < 2) { logic_out[2] = logic_out[0]; logic_out[3] = logic_out[1]; }
+    if (num_inputs < 3) for (int i = 0; i < 4; i++) logic_out[i + 4] = logic_out[i];
+    
+    int logic_id = 0;
+    for (int i = 0; i < 8; i++) logic_id += logic_out[i] * (1 << i);
+    return logic_id;
+  }
+  
+  void RunTests()
+  {
+    const int env_inputs[3] = { 0x0f13149f, 0x33083ee5, 0x556837ca };
+    const int nand_out = ~(env_inputs[0] & env_inputs[1]);
+    ReportTestResult("Nand", (cLogicIdentifier::ComputeLogicId(env_inputs, 3, nand_out) == 119));
+    ReportTestResult("Inconsistent Output", (cLogicIdentifier::ComputeLogicId(env_inputs, 3, nand_out ^ 0x10) == -1));
+    ReportTestResult("Echo Without Inputs", (cLogicIdentifier::ComputeLogicId(env_inputs, 0, 0) == 0));
+    
+    // Fuzz against the original implementation: random inputs, outputs that are mostly true logic functions of them,
+    // some of them corrupted, and cached identifiers reused across calls
+    unsigned int seed = 1;
+    bool result = true;
+    cLogicIdentifier ident;
+    for (int trial = 0; trial < 200000 && result; trial++) {
+      int inputs[3];
+      for (int i = 0; i < 3; i++) {
+        seed = seed * 1103515245u + 12345u;
+        inputs[i] = static_cast<int>((seed >> 16) ^ (seed << 15));
+      }
+      if (trial % 3 == 0) for (int i = 0; i < 3; i++) inputs[i] = env_inputs[i];
+      seed = seed * 1103515245u + 12345u;
+      const int num_inputs = (seed >> 16) % 5;
+      const int function = (seed >> 8) & 0xff;
+      
+      unsigned int output = 0;
+      const unsigned int a = (num_inputs > 0) ? inputs[0] : 0;
+      const unsigned int b = (num_inputs > 1) ? inputs[1] : 0;
+      const unsigned int c = (num_inputs > 2) ? inputs[2] : 0;
+      for (int combo = 0; combo < 8; combo++) {
+        if ((function >> combo) & 1) output |= ((combo & 1) ? a : ~a) & ((combo & 2) ? b : ~b) & ((combo & 4) ? c : ~c);
+      }
+      seed = seed * 1103515245u + 12345u;
+      if ((seed >> 16) % 4 == 0) output ^= 1u << ((seed >> 8) % 32);
+      if ((seed >> 16) % 16 == 1) output = seed;
+      
+      const int expected = ReferenceLogicId(inputs, num_inputs, static_cast<int>(output));
+      ident.SetInputs(inputs, num_inputs);
+      result = (ident.GetLogicId(static_cast<int>(output)) == expected) &&
+               (ident.GetLogicId(static_cast<int>(output)) == expected) &&
+               (cLogicIdentifier::ComputeLogicId(inputs, num_inputs, static_cast<int>(output)) == expected);
+    }
+    ReportTestResult("Fuzz Against Bitwise Reference", result);
+  }
+};
+
+
+
+#include "cSpatialResCount.h"
+#include "cWorkerPool.h"
+#include "nGeometry.h"
+#include <cmath>
+class cSpatialResCountTests : public cUnitTest
+{
+public:
+  const char* GetUnitName() { return "cSpatialResCount"; }
+protected:
+  // Copy of the original per-cell implementation (cSpatialCountElem links and FlowMatter), which the flat-array and
+  // sparse paths of cSpatialResCount must reproduce bit for bit
+  class cReferenceGrid
+  {
+  private:
+    int m_x, m_y;
+    double m_xd, m_yd, m_xg, m_yg;
+    Apto::Array<double> m_amount, m_delta;
+    Apto::Array<int> m_link, m_xdist, m_ydist;   // [cell * 8 + k], links clockwise from the upper left neighbor
+    Apto::Array<double> m_dist;
+    
+    static int mod(int x, int y) { int m = x % y; return (m < 0) ? m + y : m; }
+    
+    void setPtr(int cell, int k, int link, int xdist, int ydist, double dist)
+    {
+      m_link[cell * 8 + k] = link; m_xdist[cell * 8 + k] = xdist; m_ydist[cell * 8 + k] = ydist; m_dist[cell * 8 + k] = dist;
+    }
+    
+    void flowMatter(int c1, int c2, int xdist, int ydist, double dist)
+    {
+      double diff, flowamt, xgravity, xdiffuse, ygravity, ydiffuse;
+      if (((m_amount[c1] == 0.0) && (m_amount[c2] == 0.0)) && (dist < 0.0)) return;
+      diff = (m_amount[c1] - m_amount[c2]);
+      if (xdist != 0) {
+        if (((xdist>0) && (m_xg>0.0)) || ((xdist<0) && (m_xg<0.0))) xgravity = m_amount[c1] * fabs(m_xg)/3.0;
+        else xgravity = -m_amount[c2] * fabs(m_xg)/3.0;
+        xdiffuse = m_xd * diff / 16.0;
+      } else {
+        xdiffuse = 0.0;
+        xgravity = 0.0;
+      }
+      if (ydist != 0) {
+        if (((ydist>0) && (m_yg>0.0)) || ((ydist<0) && (m_yg<0.0))) ygravity = m_amount[c1] * fabs(m_yg)/3.0;
+        else ygravity = -m_amount[c2] * fabs(m_yg)/3.0;
+        ydiffuse = m_yd * diff / 16.0;
+      } else {
+        ydiffuse = 0.0;
+        ygravity = 0.0;
+      }
+      flowamt = ((xdiffuse + ydiffuse + xgravity + ygravity)/(fabs(xdist*1.0) + fabs(ydist*1.0)))/dist;
+      m_delta[c1] -= flowamt;
+      m_delta[c2] += flowamt;
+    }
+    
+  public:
+    cReferenceGrid(int x, int y, bool bounded, double xd, double yd, double xg, double yg)
+      : m_x(x), m_y(y), m_xd(xd), m_yd(yd), m_xg(xg), m_yg(yg)
+    {
+      const int num_cells = x * y;
+      m_amount.ResizeClear(num_cells); m_amount.SetAll(0.0);
+      m_delta.ResizeClear(num_cells); m_delta.SetAll(0.0);
+      m_link.ResizeClear(num_cells * 8); m_xdist.ResizeClear(num_cells * 8); m_ydist.ResizeClear(num_cells * 8);
+      m_dist.ResizeClear(num_cells * 8);
+      
+      const int dx[8] = { -1, 0, +1, +1, +1, 0, -1, -1 };
+      const int dy[8] = { -1, -1, -1, 0, +1, +1, +1, 0 };
+      for (int i = 0; i < num_cells; i++) {
+        for (int k = 0; k < 8; k++) {
+          const int link = mod(mod(i / x + dy[k], y), y) * x + mod(i % x + dx[k], x);
+          setPtr(i, k, link, dx[k], dy[k], (dx[k] && dy[k]) ? sqrt(2.0) : 1.0);
+        }
+      }
+      if (bounded) {
+        const int none = cResource::NONE;
+        for (int i = 0; i < x; i++) {
+          for (int k = 0; k <= 2; k++) setPtr(i, k, none, none, none, none);
+          for (int k = 4; k <= 6; k++) setPtr(num_cells - 1 - i, k, none, none, none, none);
+        }
+        for (int i = 0; i < y; i++) {
+          setPtr(i * x, 0, none, none, none, none); setPtr(i * x, 7, none, none, none, none);
+          setPtr(i * x, 6, none, none, none, none);
+          for (int k = 2; k <= 4; k++) setPtr((i + 1) * x - 1, k, none, none, none, none);
+        }
+      }
+    }
+    
+    double GetAmount(int cell) const { return m_amount[cell]; }
+    void SetAmount(int cell, double amount) { m_amount[cell] = amount; }
+    
+    void Source(double amount, int x1, int y1, int x2, int y2)
+    {
+      amount /= (y2 - y1 + 1) * (x2 - x1 + 1) * 1.0;
+      for (int i = y1; i <= y2; i++) for (int j = x1; j <= x2; j++) m_delta[mod(i, m_y) * m_x + mod(j, m_x)] += amount;
+    }
+    
+    void Sink(double decay, int x1, int y1, int x2, int y2)
+    {
+      for (int i = y1; i <= y2; i++) {
+        for (int j = x1; j <= x2; j++) {
+          const int elem = mod(i, m_y) * m_x + mod(j, m_x);
+          m_delta[elem] += -Apto::Max((m_amount[elem] * (1.0 - decay)), 0.0);
+        }
+      }
+    }
+    
+    void FlowAll()
+    {
+      if ((m_xd == 0.0) && (m_yd == 0.0) && (m_xg == 0.0) && (m_yg == 0.0)) return;
+      for (int i = 0; i < m_x * m_y; i++) {
+        for (int k = 3; k <= 6; k++) {
+          const int ii = m_link[i * 8 + k];
+          if (ii >= 0) flowMatter(i, ii, m_xdist[i * 8 + k], m_ydist[i * 8 + k], m_dist[i * 8 + k]);
+        }
+      }
+    }
+    
+    void StateAll()
+    {
+      for (int i = 0; i < m_x * m_y; i++) { m_amount[i] += m_delta[i]; m_delta[i] = 0.0; }
+    }
+  };
+  
+  
+  // Runs the reference and cSpatialResCount side by side from the same state, comparing every cell exactly after
+  // each update.  A source box smaller than the grid starts the resource off sparse, so both the sparse and the
+  // full-grid flow paths are exercised as it spreads.
+  bool compareRun(int x, int y, bool bounded, double xg, double yg, int src_x, int src_y, int src_size, bool fill,
+                  int steps, cWorkerPool* pool, unsigned int seed)
+  {
+    cReferenceGrid ref(x, y, bounded, 1.0, 0.8, xg, yg);
+    cSpatialResCount res(x, y, bounded ? nGeometry::GRID : nGeometry::TORUS, 1.0, 0.8, xg, yg);
+    
+    // Boxes may run past the right and bottom edges, in which case they wrap as they do after CheckRanges()
+    res.SetInflowX1(src_x); res.SetInflowX2(src_x + src_size - 1);
+    res.SetInflowY1(src_y); res.SetInflowY2(src_y + src_size - 1);
+    res.SetOutflowX1(src_x + 1); res.SetOutflowX2(src_x + 2 * src_size);
+    res.SetOutflowY1(src_y); res.SetOutflowY2(src_y + src_size);
+    
+    if (fill) {
+      for (int i = 0; i < x * y; i++) {
+        seed = seed * 1103515245u + 12345u;
+        const double amount = ((seed >> 8) % 1000) * 0.013;
+        ref.SetAmount(i, amount);
+        res.SetCellAmount(i, amount);
+      }
+    }
+    
+    for (int step = 0; step < steps; step++) {
+      seed = seed * 1103515245u + 12345u;
+      const double inflow = 10.0 + ((seed >> 8) % 100) * 0.37;
+      
+      ref.Source(inflow, src_x, src_y, src_x + src_size - 1, src_y + src_size - 1);
+      res.Source(inflow);
+      ref.FlowAll();
+      res.FlowAll(pool);
+      ref.Sink(0.97, src_x + 1, src_y, src_x + 2 * src_size, src_y + src_size);
+      res.Sink(0.97);
+      ref.StateAll();
+      res.StateAll();
+      
+      // An occasional external change, as a consuming organism would make
+      if (step % 7 == 3) {
+        seed = seed * 1103515245u + 12345u;
+        const int cell = (seed >> 8) % (x * y);
+        ref.SetAmount(cell, ref.GetAmount(cell) * 0.5);
+        res.SetCellAmount(cell, res.GetAmount(cell) * 0.5);
+      }
+      
+      for (int i = 0; i < x * y; i++) if (ref.GetAmount(i) != res.GetAmount(i)) return false;
+    }
+    return true;
+  }
+  
+  void RunTests()
+  {
+    const double gravity[3] = { 0.0, 0.3, -0.2 };
+    
+    bool result = true;
+    for (int x = 1; x <= 7 && result; x++) {
+      for (int y = 1; y <= 6 && result; y++) {
+        for (int g = 0; g < 9 && result; g++) {
+          result = compareRun(x, y, false, gravity[g % 3], gravity[g / 3], 0, 0, 1, true, 12, NULL, x * 31 + y * 7 + g) &&
+                   compareRun(x, y, true, gravity[g % 3], gravity[g / 3], 0, 0, 1, true, 12, NULL, x * 31 + y * 7 + g);
+        }
+      }
+    }
+    ReportTestResult("Small Grids vs. Reference (Torus and Bounded)", result);
+    
+    result = true;
+    for (int g = 0; g < 9 && result; g++) {
+      result = compareRun(40, 30, false, gravity[g % 3], gravity[g / 3], 5, 3, 4, true, 25, NULL, 11 + g) &&
+               compareRun(40, 30, true, gravity[g % 3], gravity[g / 3], 5, 3, 4, true, 25, NULL, 11 + g);
+    }
+    ReportTestResult("Dense Grid vs. Reference", result);
+    
+    result = true;
+    for (int g = 0; g < 9 && result; g++) {
+      result = compareRun(48, 40, false, gravity[g % 3], gravity[g / 3], 45, 38, 3, false, 60, NULL, 23 + g) &&
+               compareRun(48, 40, true, gravity[g % 3], gravity[g / 3], 20, 15, 3, false, 60, NULL, 23 + g);
+    }
+    ReportTestResult("Sparse Patch vs. Reference", result);
+    
+    cWorkerPool pool(4);
+    result = compareRun(160, 120, false, 0.3, -0.2, 150, 110, 20, true, 4, &pool, 5) &&
+             compareRun(160, 120, true, -0.2, 0.3, 70, 50, 20, false, 4, &pool, 7);
+    ReportTestResult("Worker Pool Stripes vs. Reference", result);
+  }
+};
+
+
+
+
+#include "apto/core/FileSystem.h"
+#include "avida/Avida.h"
+#include "avida/core/World.h"
+#include "cAvidaConfig.h"
+#include "cAvidaContext.h"
+#include "cGradientCount.h"
+#include "cStats.h"
+#include "cUserFeedback.h"
+#include "cWorld.h"
+class cGradientCountTests : public cUnitTest
+{
+public:
+  const char* GetUnitName() { return "cGradientCount"; }
+protected:
+  // Copy of the original peak update, which refilled every cell in range of the peak (the whole world after a reset)
+  // with a square root per cell.  Only plain moving peaks are covered (no halos, habitats, or probabilistic cells);
+  // the incremental refill of cGradientCount must reproduce it bit for bit.
+  class cReferencePeak
+  {
+  private:
+    int m_world_x, m_world_y;
+    Apto::Array<double> m_amount;
+    bool m_modified;
+    int m_update;
+
+    int m_peakx, m_peaky, m_height, m_spread;
+    double m_plateau;
+    int m_decay, m_max_x, m_max_y, m_min_x, m_min_y;
+    double m_move_a_scaler;
+    int m_updatestep, m_move_speed;
+    double m_plateau_inflow, m_plateau_outflow, m_cone_inflow, m_cone_outflow, m_gradient_inflow;
+    int m_is_plateau_common;
+
+    double m_move_y_scaler;
+    int m_counter, m_move_counter, m_movesignx, m_movesigny, m_old_peakx, m_old_peaky;
+    bool m_just_reset;
+    double m_past_height, m_current_height, m_ave_plat_cell_loss, m_common_plat_height;
+    int m_skip_moves, m_skip_counter;
+    Apto::Array<double> m_plateau_array;
+    Apto::Array<int> m_plateau_cell_IDs;
+    int m_min_usedx, m_min_usedy, m_max_usedx, m_max_usedy;
+
+    void updateBounds(int x, int y)
+    {
+      if (x < m_min_usedx || m_min_usedx == -1) m_min_usedx = x;
+      if (y < m_min_usedy || m_min_usedy == -1) m_min_usedy = y;
+      if (x > m_max_usedx || m_max_usedx == -1) m_max_usedx = x;
+      if (y > m_max_usedy || m_max_usedy == -1) m_max_usedy = y;
+    }
+
+    void resetUsedBounds() { m_min_usedx = -1; m_min_usedy = -1; m_max_usedx = -1; m_max_usedy = -1; }
+
+    void generatePeak(Apto::Random& rng)
+    {
+      const int temp_height = (m_plateau < 0) ? 1 : m_height;
+      if (m_peakx == -1) m_peakx = rng.GetUInt(m_min_x + temp_height, m_max_x - temp_height + 1);
+      if (m_peaky == -1) m_peaky = rng.GetUInt(m_min_y + temp_height, m_max_y - temp_height + 1);
+      if (m_move_a_scaler > 1) {
+        m_movesignx = rng.GetInt(-1,2);
+        if (m_movesignx == 0) m_movesigny = (rng.GetUInt(0,2) == 1) ? -1 : 1;
+        else m_movesigny = rng.GetInt(-1,2);
+      }
+      m_modified = false;
+      m_counter = 0;
+      m_skip_counter = 0;
+      m_just_reset = true;
+      fillinResourceValues();
+    }
+
+    void updatePeakRes(Apto::Random& rng)
+    {
+      bool has_edible = false;
+      if (m_decay > 1) {
+        int max_pos_x = Apto::Min(m_peakx + m_spread + 1, m_world_x - 1);
+        int min_pos_x = Apto::Max(m_peakx - m_spread - 1, 0);
+        int max_pos_y = Apto::Min(m_peaky + m_spread + 1, m_world_y - 1);
+        int min_pos_y = Apto::Max(m_peaky - m_spread - 1, 0);
+        for (int ii = min_pos_x; ii < max_pos_x + 1; ii++) {
+          for (int jj = min_pos_y; jj < max_pos_y + 1; jj++) {
+            if (m_amount[jj * m_world_x + ii] >= 1) {
+              has_edible = true;
+              break;
+            }
+          }
+        }
+      }
+      if (has_edible && m_modified && m_decay > 1) m_counter++;
+      if (has_edible && m_counter < m_decay && m_modified) return;
+
+      if (m_decay == 1) getCurrentPlatValues();
+      if (m_counter == m_decay) generatePeak(rng);
+      if (m_move_a_scaler > 1) m_move_y_scaler = m_move_a_scaler * m_move_y_scaler * (1 - m_move_y_scaler);
+      if (m_skip_counter == m_skip_moves) moveRes(rng);
+      else m_skip_counter++;
+
+      if (m_move_a_scaler > 1 || m_plateau_inflow != 0 || m_plateau_outflow != 0 || m_cone_inflow != 0 || m_cone_outflow != 0
+      || m_gradient_inflow != 0 || (m_move_a_scaler == 1 && m_just_reset)) fillinResourceValues();
+    }
+
+    void fillinResourceValues()
+    {
+      int max_pos_x;
+      int min_pos_x;
+      int max_pos_y;
+      int min_pos_y;
+      resetUsedBounds();
+
+      if (m_just_reset) {
+        if (m_min_usedx == -1 || m_min_usedy == -1 || m_max_usedx == -1 || m_max_usedy == -1) {
+          max_pos_x = m_world_x - 1;
+          min_pos_x = 0;
+          max_pos_y = m_world_y - 1;
+          min_pos_y = 0;
+        } else {
+          max_pos_x = m_max_usedx;
+          min_pos_x = m_min_usedx;
+          max_pos_y = m_max_usedy;
+          min_pos_y = m_min_usedy;
+        }
+      } else {
+        max_pos_x = Apto::Min(m_peakx + m_spread + m_move_speed + 1, m_world_x - 1);
+        min_pos_x = Apto::Max(m_peakx - m_spread - m_move_speed - 1, 0);
+        max_pos_y = Apto::Min(m_peaky + m_spread + m_move_speed + 1, m_world_y - 1);
+        min_pos_y = Apto::Max(m_peaky - m_spread - m_move_speed - 1, 0);
+      }
+
+      if (m_is_plateau_common == 1 && !m_just_reset && m_update > 0) {
+        m_current_height = m_current_height - m_ave_plat_cell_loss + m_plateau_inflow - (m_current_height * m_plateau_outflow);
+        m_common_plat_height = m_common_plat_height - m_ave_plat_cell_loss + m_plateau_inflow - (m_current_height * m_plateau_outflow);
+        if (m_common_plat_height > m_plateau && m_plateau >= 0) m_common_plat_height = m_plateau;
+        if (m_common_plat_height < 0 && m_plateau >=0) m_common_plat_height = 0;
+        if (m_current_height > m_height && m_plateau >= 0) m_current_height = m_height;
+        if (m_current_height < 0 && m_plateau >= 0) m_current_height = 0;
+      } else {
+        m_current_height = m_height;
+      }
+
+      int plateau_cell = 0;
+      for (int ii = min_pos_x; ii < max_pos_x + 1; ii++) {
+        for (int jj = min_pos_y; jj < max_pos_y + 1; jj++) {
+          double thisheight = 0.0;
+          double thisdist = sqrt((double) (m_peakx - ii) * (m_peakx - ii) + (m_peaky - jj) * (m_peaky - jj));
+          if (m_spread >= thisdist) {
+            thisheight = m_current_height / (thisdist + 1);
+            bool is_plat_cell = ((m_height / (thisdist + 1)) >= 1);
+            if ((is_plat_cell && m_plateau >= 0) || (m_plateau < 0 && thisdist == 0 && m_plateau_array.GetSize())) {
+              if (m_just_reset || m_update <= 0) {
+                m_past_height = m_height;
+                thisheight = (m_plateau >= 0.0) ? m_plateau : m_height;
+              } else if (m_is_plateau_common == 0) {
+                m_past_height = m_plateau_array[plateau_cell];
+                thisheight = m_past_height + m_plateau_inflow - (m_past_height * m_plateau_outflow);
+                thisheight += m_gradient_inflow / (thisdist + 1);
+                if (thisheight > m_plateau && m_plateau >= 0) thisheight = m_plateau;
+                if (m_plateau < 0 && thisdist == 0 && thisheight > m_height) thisheight = m_height;
+              } else if (m_is_plateau_common == 1) {
+                thisheight = m_common_plat_height;
+              }
+              if (thisheight < 0) thisheight = 0;
+              m_plateau_array[plateau_cell] = thisheight;
+              m_plateau_cell_IDs[plateau_cell] = jj * m_world_x + ii;
+              plateau_cell++;
+            } else if (!is_plat_cell && (m_cone_inflow > 0 || m_cone_outflow > 0 || m_gradient_inflow > 0)) {
+              if (!m_just_reset && m_update > 0) {
+                int old_cell_x = ii + m_old_peakx - m_peakx;
+                int old_cell_y = jj + m_old_peaky - m_peaky;
+                if (old_cell_x < 0 || old_cell_y < 0 || (old_cell_y > (m_world_y - 1)) || (old_cell_x > (m_world_x - 1))) {
+                  thisheight = 0;
+                } else {
+                  double past_height = m_amount[old_cell_y * m_world_x + old_cell_x];
+                  double newheight = past_height;
+                  if (m_cone_inflow > 0 || m_cone_outflow > 0) newheight += m_cone_inflow - (past_height * m_cone_outflow);
+                  if (m_gradient_inflow > 0) newheight += m_gradient_inflow / (thisdist + 1);
+                  if (newheight < thisheight) thisheight = newheight;
+                  if (thisheight < 0) thisheight = 0;
+                }
+              }
+            }
+          }
+          m_amount[jj * m_world_x + ii] = thisheight;
+          if (thisheight > 0) updateBounds(ii, jj);
+        }
+      }
+      m_just_reset = false;
+    }
+
+    void getCurrentPlatValues()
+    {
+      const int temp_height = (m_plateau < 0) ? 1 : m_height;
+      int plateau_cell = 0;
+      double amount_devoured = 0.0;
+      for (int ii = m_peakx - temp_height - 1; ii < m_peakx + temp_height + 2; ii++) {
+        for (int jj = m_peaky - temp_height - 1; jj < m_peaky + temp_height + 2; jj++) {
+          double thisdist = sqrt((double) (m_peakx - ii) * (double) (m_peakx - ii) + (double) (m_peaky - jj) * (double) (m_peaky - jj));
+          double find_plat_dist = temp_height / (thisdist + 1);
+          if ((find_plat_dist >= 1 && m_plateau >= 0) || (m_plateau < 0 && thisdist == 0 && m_plateau_array.GetSize() > 0)) {
+            double past_cell_height = m_plateau_array[plateau_cell];
+            double pre_move_height = m_amount[m_plateau_cell_IDs[plateau_cell]];
+            if (pre_move_height < past_cell_height) {
+              m_plateau_array[plateau_cell] = pre_move_height;
+              amount_devoured = amount_devoured + past_cell_height - pre_move_height;
+            }
+            plateau_cell++;
+          }
+        }
+      }
+      m_ave_plat_cell_loss = amount_devoured / plateau_cell;
+    }
+
+    void moveRes(Apto::Random& rng)
+    {
+      if (m_move_counter == m_updatestep && m_move_a_scaler > 1) {
+        m_move_counter = 1;
+        const int choosesign = rng.GetInt(1,3);
+        if (choosesign == 1) {
+          if (m_movesignx == -1) m_movesignx = rng.GetInt(-1,1);
+          else if (m_movesignx == 1) m_movesignx = rng.GetInt(0,2);
+          else m_movesignx = rng.GetInt(-1,2);
+        } else if (choosesign == 2) {
+          if (m_movesigny == -1) m_movesigny = rng.GetInt(-1,1);
+          else if (m_movesigny == 1) m_movesigny = rng.GetInt(0,2);
+          else m_movesigny = rng.GetInt(-1,2);
+        }
+      }
+      else m_move_counter++;
+
+      if (m_move_a_scaler > 1) {
+        const int temp_height = (m_plateau < 0) ? 1 : m_height;
+        const int num_steps = m_move_speed > 1 ? m_move_speed : 1;
+        for (int i = 0; i < num_steps; i++) {
+          int temp_peakx = m_peakx + (int)(m_move_y_scaler + 0.5) * m_movesignx;
+          int temp_peaky = m_peaky + (int)(m_move_y_scaler + 0.5) * m_movesigny;
+          if ((temp_height * 2) < abs(m_max_x - m_min_x)) {
+            if (temp_peakx > (m_max_x - temp_height)) m_movesignx = -1;
+            if (temp_peakx < (m_min_x + temp_height + 1)) m_movesignx = 1;
+          } else {
+            m_movesignx = 0;
+          }
+          if ((temp_height * 2) < abs(m_max_y - m_min_y)) {
+            if (temp_peaky > (m_max_y - temp_height)) m_movesigny = -1;
+            if (temp_peaky < (m_min_y + temp_height + 1)) m_movesigny = 1;
+          } else {
+            m_movesigny = 0;
+          }
+          if ((temp_height * 2) < abs(m_max_x - m_min_x)) m_peakx = (int) (m_peakx + (m_movesignx * m_move_y_scaler) + .5);
+          if ((temp_height * 2) < abs(m_max_y - m_min_y)) m_peaky = (int) (m_peaky + (m_movesigny * m_move_y_scaler) + .5);
+        }
+      }
+      m_skip_counter = 0;
+    }
+
+  public:
+    cReferencePeak(Apto::Random& rng, int x, int y, int height, int spread, double plateau, int decay, double move_a_scaler,
+                   int updatestep, int move_speed, double plateau_inflow, double plateau_outflow, double cone_inflow,
+                   double cone_outflow, double gradient_inflow, int is_plateau_common)
+      : m_world_x(x), m_world_y(y), m_modified(false), m_update(0)
+      , m_peakx(-1), m_peaky(-1), m_height(height), m_spread(spread), m_plateau(plateau), m_decay(decay)
+      , m_max_x(x - 1), m_max_y(y - 1), m_min_x(0), m_min_y(0), m_move_a_scaler(move_a_scaler), m_updatestep(updatestep)
+      , m_move_speed(move_speed), m_plateau_inflow(plateau_inflow), m_plateau_outflow(plateau_outflow)
+      , m_cone_inflow(cone_inflow), m_cone_outflow(cone_outflow), m_gradient_inflow(gradient_inflow)
+      , m_is_plateau_common(is_plateau_common), m_move_y_scaler(0.5), m_counter(0), m_move_counter(1), m_movesignx(0)
+      , m_movesigny(0), m_old_peakx(-1), m_old_peaky(-1), m_just_reset(true), m_past_height(0.0), m_current_height(height)
+      , m_ave_plat_cell_loss(0.0), m_common_plat_height(plateau), m_skip_moves(0), m_skip_counter(0)
+    {
+      if (m_move_speed < 0) {
+        m_skip_moves = abs(m_move_speed);
+        m_move_speed = 1;
+      }
+      m_plateau_array.Resize(int(4 * m_height * m_height + 0.5));
+      m_plateau_array.SetAll(0);
+      m_plateau_cell_IDs.Resize(int(4 * m_height * m_height + 0.5));
+      m_plateau_cell_IDs.SetAll(0);
+      resetUsedBounds();
+      m_amount.ResizeClear(x * y);
+      m_amount.SetAll(0.0);
+      generatePeak(rng);
+      UpdateCount(rng);
+    }
+
+    void SetUpdate(int update) { m_update = update; }
+    void UpdateCount(Apto::Random& rng) { m_old_peakx = m_peakx; m_old_peaky = m_peaky; updatePeakRes(rng); }
+    void Consume(int cell, double change) { const double before = m_amount[cell]; m_amount[cell] += change; if (m_amount[cell] != before) m_modified = true; }
+
+    double GetAmount(int cell) const { return m_amount[cell]; }
+    int GetPeakX() const { return m_peakx; }
+    int GetPeakY() const { return m_peaky; }
+  };
+
+
+  // Runs the reference and cGradientCount side by side on the same random stream, with organisms biting the same
+  // cells, and checks the peak position and every cell's height after each update.  Also returns how many updates
+  // the peak moved on, so a configuration that never moves cannot pass unnoticed.
+  bool compareRun(cWorld* world, int x, int y, int height, int spread, double plateau, int decay, double move_a_scaler,
+                  int updatestep, int move_speed, double plat_in, double plat_out, double cone_in, double cone_out,
+                  double grad_in, int common, int updates, unsigned int seed, bool& same_peak, int& moves)
+  {
+    Apto::RNG::AvidaRNG ref_rng(seed);
+    cStats& stats = world->GetStats();
+    stats.SetCurrentUpdate(0);
+    world->GetRandom().ResetSeed(seed);
+    cAvidaContext& ctx = world->GetDefaultContext();
+
+    cReferencePeak ref(ref_rng, x, y, height, spread, plateau, decay, move_a_scaler, updatestep, move_speed, plat_in,
+                       plat_out, cone_in, cone_out, grad_in, common);
+    cGradientCount res(world, -1, -1, height, spread, plateau, decay, x - 1, y - 1, 0, 0, move_a_scaler, updatestep, x, y,
+                       nGeometry::GRID, 0, 0, 0, 0, 0, move_speed, 0, plat_in, plat_out, cone_in, cone_out, grad_in, common,
+                       0.0, 0, 0, 0, 0, 0, -1, 1.0, 0.0, 0.0, 0, 0);
+
+    same_peak = true;
+    moves = 0;
+    for (int update = 1; update <= updates; update++) {
+      stats.SetCurrentUpdate(update);
+      ref.SetUpdate(update);
+
+      // Organisms take a share of, or occasionally drop onto, a few cells near the peak
+      seed = seed * 1103515245u + 12345u;
+      const int bites = (seed >> 8) % 4;
+      for (int i = 0; i < bites; i++) {
+        seed = seed * 1103515245u + 12345u;
+        const int cell_x = Apto::Min(Apto::Max(ref.GetPeakX() + (int)((seed >> 8) % 7) - 3, 0), x - 1);
+        const int cell_y = Apto::Min(Apto::Max(ref.GetPeakY() + (int)((seed >> 16) % 7) - 3, 0), y - 1);
+        const int cell = cell_y * x + cell_x;
+        seed = seed * 1103515245u + 12345u;
+        const double change = ((seed >> 8) % 5 == 0) ? 0.7 : -ref.GetAmount(cell) * (((seed >> 16) % 10) / 10.0);
+
+        ref.Consume(cell, change);
+        const double before = res.GetAmount(cell);
+        res.Rate(cell, change);
+        res.State(cell);
+        if (res.GetAmount(cell) != before) res.SetModified(true);
+      }
+
+      const int last_x = ref.GetPeakX();
+      const int last_y = ref.GetPeakY();
+      ref.UpdateCount(ref_rng);
+      res.UpdateCount(ctx);
+      res.StateAll();
+      if (ref.GetPeakX() != last_x || ref.GetPeakY() != last_y) moves++;
+
+      if (res.GetCurrPeakX() != ref.GetPeakX() || res.GetCurrPeakY() != ref.GetPeakY()) same_peak = false;
+      for (int i = 0; i < x * y; i++) if (res.GetAmount(i) != ref.GetAmount(i)) return false;
+    }
+    return true;
+  }
+
+  void RunTests()
+  {
+    // cGradientCount draws on the world for its random numbers and the current update, so a full world is set up from
+    // the configuration files in the working directory (the work directory the unit tests are installed into)
+    Avida::Initialize();
+    cUserFeedback feedback;
+    cAvidaConfig* cfg = new cAvidaConfig();
+    const cString working_dir(Apto::FileSystem::GetCWD());
+    cfg->Load("avida.cfg", working_dir, &feedback, NULL, false);
+    cWorld* world = cWorld::Initialize(cfg, working_dir, new Avida::World(), &feedback);
+    ReportTestResult("World Setup (run from the work directory)", world != NULL);
+    if (!world) return;
+
+    bool same_peak = true;
+    int moves = 0;
+
+    // A depletable peak moving every update, with plateau, cone, and gradient inflow and outflow
+    bool result = compareRun(world, 40, 30, 3, 8, 2.0, 1, 3.8, 3, 1, 0.3, 0.1, 0.2, 0.05, 0.5, 0, 300, 3, same_peak, moves);
+    ReportTestResult("Moving Peak: Height vs. Reference", result);
+    ReportTestResult("Moving Peak: Position vs. Reference", same_peak);
+    ReportTestResult("Moving Peak: Movement", moves > 0);
+
+    // A peak that stops once bitten and regrows after decay, moving only every third update, with a common plateau
+    result = compareRun(world, 35, 45, 2, 5, 1.0, 3, 3.2, 2, -2, 0.3, 0.0, 0.0, 0.0, 0.0, 1, 300, 7, same_peak, moves);
+    ReportTestResult("Decaying Peak: Height vs. Reference", result);
+    ReportTestResult("Decaying Peak: Position vs. Reference", same_peak);
+    ReportTestResult("Decaying Peak: Movement", moves > 0);
+
+    // A cone with no plateau, moving two cells at a time
+    result = compareRun(world, 50, 50, 4, 9, -1.0, 1, 3.5, 4, 2, 0.0, 0.0, 0.4, 0.1, 0.0, 0, 300, 11, same_peak, moves);
+    ReportTestResult("Fast Cone: Height vs. Reference", result);
+    ReportTestResult("Fast Cone: Position vs. Reference", same_peak);
+    ReportTestResult("Fast Cone: Movement", moves > 0);
+
+    delete world;
+  }
+};
+
+
+
+
+#include "cOccupancyIndex.h"
+class cOccupancyIndexTests : public cUnitTest
+{
+public:
+  const char* GetUnitName() { return "cOccupancyIndex"; }
+protected:
+  static int wrap(int v, int size) { int m = v % size; return (m < 0) ? m + size : m; }
+  static int next(unsigned int& seed, int range) { seed = seed * 1103515245u + 12345u; return (seed >> 8) % range; }
+  
+  // Occupant counts kept alongside the index, [cell * NUM_KINDS + kind]
+  class cReferenceCounts
+  {
+  private:
+    int m_x, m_y;
+    Apto::Array<int> m_counts;
+  public:
+    cReferenceCounts(int x, int y) : m_x(x), m_y(y) { m_counts.Resize(x * y * cOccupancyIndex::NUM_KINDS); m_counts.SetAll(0); }
+    
+    void Set(int cell, const int counts[cOccupancyIndex::NUM_KINDS])
+    {
+      for (int k = 0; k < cOccupancyIndex::NUM_KINDS; k++) m_counts[cell * cOccupancyIndex::NUM_KINDS + k] = counts[k];
+    }
+    int Get(int kind, int x, int y) const { return m_counts[(y * m_x + x) * cOccupancyIndex::NUM_KINDS + kind]; }
+    
+    int Count(int kind, int min_x, int min_y, int max_x, int max_y) const
+    {
+      int total = 0;
+      for (int y = min_y; y <= max_y; y++) {
+        for (int x = min_x; x <= max_x; x++) if (x >= 0 && x < m_x && y >= 0 && y < m_y) total += Get(kind, x, y);
+      }
+      return total;
+    }
+    
+    int CountTorus(int kind, int min_x, int min_y, int max_x, int max_y) const
+    {
+      // spans as wide as the world cover each cell once
+      if (max_x - min_x + 1 > m_x) max_x = min_x + m_x - 1;
+      if (max_y - min_y + 1 > m_y) max_y = min_y + m_y - 1;
+      int total = 0;
+      for (int y = min_y; y <= max_y; y++) {
+        for (int x = min_x; x <= max_x; x++) total += Get(kind, wrap(x, m_x), wrap(y, m_y));
+      }
+      return total;
+    }
+  };
+  
+  // Fills cells with random occupants, including multiple avatars per cell, and empties some again (organisms dying,
+  // avatars leaving), keeping the reference in step
+  void populate(cOccupancyIndex& index, cReferenceCounts& ref, int x, int y, int changes, unsigned int& seed)
+  {
+    for (int i = 0; i < changes; i++) {
+      const int cell = next(seed, x * y);
+      int counts[cOccupancyIndex::NUM_KINDS];
+      const bool empty = (next(seed, 4) == 0);
+      for (int k = 0; k < cOccupancyIndex::NUM_KINDS; k++) counts[k] = (empty || next(seed, 3) != 0) ? 0 : 1 + next(seed, 3);
+      index.SetCell(cell, counts);
+      ref.Set(cell, counts);
+    }
+  }
+  
+  static void walkDirs(int facing, Apto::Coord<int>& ahead, Apto::Coord<int>& left, Apto::Coord<int>& right)
+  {
+    // as cOrgSensor::SetCoords, facing 0 = north clockwise to 7 = northwest
+    static const int ahead_x[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+    static const int ahead_y[8] = { -1, -1, 0, 1, 1, 1, 0, -1 };
+    static const int side[8][4] = { { -1, 0, 1, 0 }, { -1, 0, 0, 1 }, { 0, -1, 0, 1 }, { 0, -1, -1, 0 },
+                                    { -1, 0, 1, 0 }, { 1, 0, 0, -1 }, { 0, -1, 0, 1 }, { 0, 1, 1, 0 } };
+    ahead.Set(ahead_x[facing], ahead_y[facing]);
+    left.Set(side[facing][0], side[facing][1]);
+    right.Set(side[facing][2], side[facing][3]);
+  }
+  
+  void RunTests()
+  {
+    unsigned int seed = 11;
+    
+    bool result = true;
+    for (int trial = 0; trial < 200 && result; trial++) {
+      const int x = 1 + next(seed, 30);
+      const int y = 1 + next(seed, 30);
+      cOccupancyIndex index;
+      index.Resize(x, y);
+      cReferenceCounts ref(x, y);
+      for (int round = 0; round < 20 && result; round++) {
+        populate(index, ref, x, y, 1 + next(seed, x * y), seed);
+        for (int q = 0; q < 20 && result; q++) {
+          const int kind = next(seed, cOccupancyIndex::NUM_KINDS);
+          const int min_x = next(seed, x + 6) - 3;
+          const int min_y = next(seed, y + 6) - 3;
+          const int max_x = min_x + next(seed, x + 4) - 1;
+          const int max_y = min_y + next(seed, y + 4) - 1;
+          result = (index.Count(kind, min_x, min_y, max_x, max_y) == ref.Count(kind, min_x, min_y, max_x, max_y));
+        }
+      }
+    }
+    ReportTestResult("Count vs. Brute Force (Clipped to World)", result);
+    
+    result = true;
+    int wrapped_both = 0;
+    for (int trial = 0; trial < 200 && result; trial++) {
+      const int x = 1 + next(seed, 30);
+      const int y = 1 + next(seed, 30);
+      cOccupancyIndex index;
+      index.Resize(x, y);
+      cReferenceCounts ref(x, y);
+      for (int round = 0; round < 20 && result; round++) {
+        populate(index, ref, x, y, 1 + next(seed, x * y), seed);
+        for (int q = 0; q < 20 && result; q++) {
+          const int kind = next(seed, cOccupancyIndex::NUM_KINDS);
+          const int min_x = next(seed, 4 * x) - 2 * x;
+          const int min_y = next(seed, 4 * y) - 2 * y;
+          const int max_x = min_x + next(seed, x + 3) - 1;
+          const int max_y = min_y + next(seed, y + 3) - 1;
+          if (max_x - min_x + 1 < x && max_y - min_y + 1 < y && wrap(min_x, x) > wrap(max_x, x) && wrap(min_y, y) > wrap(max_y, y)) {
+            wrapped_both++;
+          }
+          result = (index.CountTorus(kind, min_x, min_y, max_x, max_y) == ref.CountTorus(kind, min_x, min_y, max_x, max_y));
+        }
+      }
+    }
+    ReportTestResult("CountTorus vs. Brute Force (Wrapping on Both Axes)", result && wrapped_both > 100);
+    
+    // Every cell a sensor walk visits lies in WalkBounds(), so a walk that would see an occupant is never skipped
+    result = true;
+    for (int trial = 0; trial < 100 && result; trial++) {
+      const int x = 1 + next(seed, 30);
+      const int y = 1 + next(seed, 30);
+      const bool torus = (trial % 2 == 1);
+      cOccupancyIndex index;
+      index.Resize(x, y);
+      cReferenceCounts ref(x, y);
+      populate(index, ref, x, y, 1 + next(seed, 2 * x), seed);
+      for (int q = 0; q < 100 && result; q++) {
+        Apto::Coord<int> ahead(0, 0);
+        Apto::Coord<int> left(0, 0);
+        Apto::Coord<int> right(0, 0);
+        walkDirs(next(seed, 8), ahead, left, right);
+        const int start = next(seed, 3);
+        const int end = start + next(seed, 20);
+        const Apto::Coord<int> center(next(seed, x), next(seed, y));
+        Apto::Coord<int> min_cell(0, 0);
+        Apto::Coord<int> max_cell(0, 0);
+        cOccupancyIndex::WalkBounds(center, ahead, left, right, start, end, min_cell, max_cell);
+        
+        const int kind = next(seed, cOccupancyIndex::NUM_KINDS);
+        int seen = 0;
+        for (int dist = start; dist <= end && result; dist++) {
+          const Apto::Coord<int> dist_center = center + ahead * (dist - start);
+          for (int j = -(dist / 2); j <= dist / 2 && result; j++) {
+            const Apto::Coord<int> cell = (j < 0) ? dist_center + left * -j : dist_center + right * j;
+            result = (cell.X() >= min_cell.X() && cell.X() <= max_cell.X() && cell.Y() >= min_cell.Y() && cell.Y() <= max_cell.Y());
+            if (torus) seen += ref.Get(kind, wrap(cell.X(), x), wrap(cell.Y(), y));
+            else if (cell.X() >= 0 && cell.X() < x && cell.Y() >= 0 && cell.Y() < y) seen += ref.Get(kind, cell.X(), cell.Y());
+          }
+        }
+        const int found = torus ? index.CountTorus(kind, min_cell.X(), min_cell.Y(), max_cell.X(), max_cell.Y())
+                                : index.Count(kind, min_cell.X(), min_cell.Y(), max_cell.X(), max_cell.Y());
+        if (seen > 0 && found == 0) result = false;
+      }
+    }
+    ReportTestResult("Walk Bounds Cover Every Walked Cell", result);
+  }
+};
+
+
+
+#include "cBatchProbSchedule.h"
+#include "apto/rng.h"
+class cBatchProbScheduleTests : public cUnitTest
+{
+public:
+  const char* GetUnitName() { return "cBatchProbSchedule"; }
+protected:
+  static int next(unsigned int& seed, int range) { seed = seed * 1103515245u + 12345u; return (seed >> 8) % range; }
+  
+  // Draws num_draws entries and checks each entry's count against its share of the total priority, allowing five
+  // standard deviations of the binomial count; entries with zero priority must never be drawn
+  bool checkFrequencies(cBatchProbSchedule& schedule, const Apto::Array<double>& priorities, int num_draws)
+  {
+    const int num_entries = priorities.GetSize();
+    double total = 0.0;
+    for (int i = 0; i < num_entries; i++) total += priorities[i];
+    
+    Apto::Array<int> counts(num_entries);
+    counts.SetAll(0);
+    for (int d = 0; d < num_draws; d++) {
+      const int entry = schedule.Next();
+      if (entry < 0 || entry >= num_entries || priorities[entry] <= 0.0) return false;
+      counts[entry]++;
+    }
+    
+    for (int i = 0; i < num_entries; i++) {
+      const double p = priorities[i] / total;
+      const double expected = num_draws * p;
+      if (fabs(counts[i] - expected) > 5.0 * sqrt(num_draws * p * (1.0 - p)) + 1.0) return false;
+    }
+    return true;
+  }
+  
+  void RunTests()
+  {
+    const int num_entries = 37;
+    unsigned int seed = 3;
+    Apto::SmartPtr<Apto::Random> rng(new Apto::RNG::AvidaRNG(5));
+    
+    bool result = true;
+    {
+      cBatchProbSchedule schedule(num_entries, rng, 16);
+      result = (schedule.Next() == -1);
+      Apto::Array<double> priorities(num_entries);
+      priorities.SetAll(0.0);
+      for (int round = 0; round < 10 && result; round++) {
+        for (int k = 0; k < 10; k++) {
+          const int entry = next(seed, num_entries);
+          priorities[entry] = (next(seed, 4) == 0) ? 0.0 : 0.5 + next(seed, 1000) * 0.37;
+          schedule.AdjustPriority(entry, priorities[entry]);
+        }
+        double total = 0.0;
+        for (int i = 0; i < num_entries; i++) total += priorities[i];
+        result = (total > 0.0) && checkFrequencies(schedule, priorities, 200000);
+      }
+    }
+    ReportTestResult("Selection Frequencies Follow Priorities", result);
+    
+    result = true;
+    {
+      // a single heavy entry among light ones, across batch sizes
+      const int batch_sizes[3] = { 1, 7, 64 };
+      for (int b = 0; b < 3 && result; b++) {
+        cBatchProbSchedule schedule(num_entries, rng, batch_sizes[b]);
+        Apto::Array<double> priorities(num_entries);
+        for (int i = 0; i < num_entries; i++) priorities[i] = (i == 20) ? 1000.0 : 1.0;
+        for (int i = 0; i < num_entries; i++) schedule.AdjustPriority(i, priorities[i]);
+        result = checkFrequencies(schedule, priorities, 200000);
+      }
+    }
+    ReportTestResult("Skewed Priorities Across Batch Sizes", result);
+    
+    result = true;
+    {
+      // a priority change applies from the very next draw, even partway through a batch
+      cBatchProbSchedule schedule(num_entries, rng, 64);
+      schedule.AdjustPriority(3, 1.0);
+      for (int d = 0; d < 10 && result; d++) result = (schedule.Next() == 3);
+      schedule.AdjustPriority(3, 0.0);
+      schedule.AdjustPriority(30, 2.0);
+      for (int d = 0; d < 10 && result; d++) result = (schedule.Next() == 30);
+      schedule.AdjustPriority(30, 0.0);
+      result = result && (schedule.Next() == -1);
+    }
+    ReportTestResult("Priority Changes Apply to the Next Draw", result);
+    
+    result = true;
+    {
+      // ordered sweeps keep the shares and only step back to a lower id when a new sweep starts
+      cBatchProbSchedule schedule(num_entries, rng, 64, true);
+      Apto::Array<double> priorities(num_entries);
+      for (int i = 0; i < num_entries; i++) {
+        priorities[i] = (next(seed, 4) == 0) ? 0.0 : 0.5 + next(seed, 1000) * 0.37;
+        schedule.AdjustPriority(i, priorities[i]);
+      }
+      result = checkFrequencies(schedule, priorities, 200000);
+      
+      int prev = -1;
+      int descents = 0;
+      for (int d = 0; d < 64000; d++) {
+        const int entry = schedule.Next();
+        if (entry < prev) descents++;
+        prev = entry;
+      }
+      result = result && (descents < 2000);
+    }
+    ReportTestResult("Ordered Sweeps Follow Priorities in Id Order", result);
+    
+    result = true;
+    {
+      // entries emptied and refilled mid-sweep still get the share their priority earns while they are nonzero
+      cBatchProbSchedule schedule(num_entries, rng, 64, true);
+      Apto::Array<double> priorities(num_entries);
+      Apto::Array<double> expected(num_entries);
+      Apto::Array<int> counts(num_entries);
+      for (int i = 0; i < num_entries; i++) {
+        priorities[i] = 1.0 + next(seed, 1000) * 0.01;
+        schedule.AdjustPriority(i, priorities[i]);
+      }
+      expected.SetAll(0.0);
+      counts.SetAll(0);
+      int num_alive = num_entries;
+      for (int d = 0; d < 400000 && result; d++) {
+        if (next(seed, 10) == 0) {
+          const int entry = next(seed, num_entries);
+          if (priorities[entry] == 0.0) {
+            priorities[entry] = 1.0 + next(seed, 1000) * 0.01;
+            num_alive++;
+          } else if (num_alive > 1) {
+            priorities[entry] = 0.0;
+            num_alive--;
+          }
+          schedule.AdjustPriority(entry, priorities[entry]);
+        }
+        double total = 0.0;
+        for (int i = 0; i < num_entries; i++) total += priorities[i];
+        for (int i = 0; i < num_entries; i++) expected[i] += priorities[i] / total;
+        const int entry = schedule.Next();
+        result = (entry >= 0 && entry < num_entries && priorities[entry] > 0.0);
+        if (result) counts[entry]++;
+      }
+      for (int i = 0; i < num_entries && result; i++) {
+        result = (fabs(counts[i] - expected[i]) <= 5.0 * sqrt(expected[i]) + 1.0);
+      }
+    }
+    ReportTestResult("Ordered Sweeps Give Refilled Entries Their Share", result);
+  }
+};
+
 
 
 #define TEST(CLASS) \
@@ -333,6 +1324,11 @@ int main(int argc, const char* argv[])
   
   TEST(cRawBitArray);
   TEST(cBitArray);
+  TEST(cLogicIdentifier);
+  TEST(cSpatialResCount);
+  TEST(cGradientCount);
+  TEST(cOccupancyIndex);
+  TEST(cBatchProbSchedule);
   
   if (failed == 0)
     cout << "All unit tests passed." << endl;
@@ -100,6 +100,7 @@ void cDriver_TextViewer::Run()
 {
   cPopulation& population = m_world->GetPopulation();
   cStats& stats = m_world->GetStats();
+  stats.RequireOrgStats();
   
   const int ave_time_slice = m_world->GetConfig().AVE_TIME_SLICE.Get();
   const double point_mut_prob = m_world->GetConfig().POINT_MUT_PROB.Get() +
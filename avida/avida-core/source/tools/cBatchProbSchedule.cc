@@ -0,0 +1,162 @@
+/*
+ *  cBatchProbSchedule.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cBatchProbSchedule.h"
+
+#include <algorithm>
+#include <cassert>
+
+
+cBatchProbSchedule::cBatchProbSchedule(int entry_count, Apto::SmartPtr<Apto::Random> rng, int batch_size, bool ordered)
+  : m_rng(rng)
+  , m_num_leaves(1)
+  , m_batch_size((batch_size > 0) ? batch_size : 1)
+  , m_ordered(ordered)
+  , m_batch_count(0)
+  , m_batch_pos(0)
+  , m_sweep_rate(0.0)
+  , m_last_entry(-1)
+  , m_run_left(0)
+{
+  while (m_num_leaves < entry_count) m_num_leaves *= 2;
+  m_tree.Resize(2 * m_num_leaves);
+  m_tree.SetAll(0.0);
+  m_batch.Resize(m_batch_size);
+}
+
+cBatchProbSchedule::~cBatchProbSchedule()
+{
+}
+
+
+void cBatchProbSchedule::AdjustPriority(int entry_id, double priority)
+{
+  assert(entry_id >= 0 && entry_id < m_num_leaves);
+  assert(priority >= 0.0);
+  
+  int node = m_num_leaves + entry_id;
+  if (m_tree[node] == priority) return;
+  
+  m_tree[node] = priority;
+  for (node /= 2; node > 0; node /= 2) m_tree[node] = m_tree[2 * node] + m_tree[2 * node + 1];
+  
+  if (m_ordered) {
+    // Entries the sweep has passed keep their steps, except that an emptied entry stops running
+    if (entry_id == m_last_entry && priority == 0.0) m_run_left = 0;
+    if (entry_id > m_last_entry && m_sweep_rate > 0.0) {
+      m_redrawn[entry_id] = (priority > 0.0) ? (int)m_rng->GetRandPoisson(m_sweep_rate * priority) : 0;
+    }
+    return;
+  }
+  
+  // Entries already drawn were weighted by the old priorities
+  m_batch_count = 0;
+  m_batch_pos = 0;
+}
+
+
+int cBatchProbSchedule::findEntry(double position) const
+{
+  int node = 1;
+  while (node < m_num_leaves) {
+    // Branch-free step, since which way each draw goes is a coin flip.  Rounding can leave position just past the
+    // last nonzero subtree, so never step into an empty one.
+    const double left = m_tree[2 * node];
+    const int go_right = (position >= left && m_tree[2 * node + 1] > 0.0);
+    position -= go_right ? left : 0.0;
+    node = 2 * node + go_right;
+  }
+  assert(m_tree[node] > 0.0);
+  return node - m_num_leaves;
+}
+
+
+int cBatchProbSchedule::NextBatch(Apto::Array<int>& entries, int count)
+{
+  const double total = m_tree[1];
+  if (total <= 0.0) return 0;
+  
+  if (entries.GetSize() < count) entries.Resize(count);
+  for (int i = 0; i < count; i++) entries[i] = findEntry(m_rng->GetDouble(total));
+  return count;
+}
+
+
+bool cBatchProbSchedule::startSweep()
+{
+  const double total = m_tree[1];
+  if (total <= 0.0) return false;
+  
+  // A Poisson number of draws gives each entry an independent Poisson number of steps
+  m_batch_count = (int)m_rng->GetRandPoisson(m_batch_size);
+  m_batch_pos = 0;
+  if (m_batch.GetSize() < m_batch_count) m_batch.Resize(m_batch_count);
+  if (m_positions.GetSize() < m_batch_count) m_positions.Resize(m_batch_count);
+  
+  // Leaves are laid out by id, so sorted positions land on sorted ids
+  for (int i = 0; i < m_batch_count; i++) m_positions[i] = m_rng->GetDouble(total);
+  if (m_batch_count > 0) std::sort(&m_positions[0], &m_positions[0] + m_batch_count);
+  for (int i = 0; i < m_batch_count; i++) m_batch[i] = findEntry(m_positions[i]);
+  
+  m_sweep_rate = m_batch_size / total;
+  m_last_entry = -1;
+  return true;
+}
+
+
+int cBatchProbSchedule::nextOrdered()
+{
+  while (m_run_left == 0) {
+    // The sweep reaches the lower of the next drawn entry and the next redrawn one
+    const int drawn = (m_batch_pos < m_batch_count) ? m_batch[m_batch_pos] : m_num_leaves;
+    const int redrawn = m_redrawn.empty() ? m_num_leaves : m_redrawn.begin()->first;
+    if (drawn == m_num_leaves && redrawn == m_num_leaves) {
+      if (!startSweep()) return -1;
+      continue;
+    }
+    
+    m_last_entry = (drawn < redrawn) ? drawn : redrawn;
+    while (m_batch_pos < m_batch_count && m_batch[m_batch_pos] == m_last_entry) {
+      m_run_left++;
+      m_batch_pos++;
+    }
+    if (redrawn == m_last_entry) {
+      m_run_left = m_redrawn.begin()->second;
+      m_redrawn.erase(m_redrawn.begin());
+    }
+  }
+  
+  m_run_left--;
+  return m_last_entry;
+}
+
+
+int cBatchProbSchedule::Next()
+{
+  if (m_ordered) return nextOrdered();
+  
+  if (m_batch_pos == m_batch_count) {
+    m_batch_count = NextBatch(m_batch, m_batch_size);
+    m_batch_pos = 0;
+    if (m_batch_count == 0) return -1;
+  }
+  return m_batch[m_batch_pos++];
+}
@@ -0,0 +1,92 @@
+/*
+ *  cBatchProbSchedule.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cBatchProbSchedule_h
+#define cBatchProbSchedule_h
+
+#include "avida/core/Types.h"
+
+#include "apto/rng.h"
+#include "apto/scheduler.h"
+
+#include <map>
+
+
+/**
+ * The BatchProb Schedule picks each entry with probability proportional to its priority, the same distribution as
+ * Apto::Scheduler::Probabilistic.  Priorities sit at the leaves of a sum tree stored in a single array, so adjusting
+ * one rewrites the sums along a single leaf-to-root path and a draw is a single root-to-leaf descent.  Each sum is
+ * recomputed from its two children rather than patched with a difference, so rounding error never accumulates.
+ *
+ * Draws are made a batch at a time and handed out by Next().  Any change to a priority throws away the undrawn rest
+ * of the batch, so every entry returned was drawn under the priorities in effect when it was returned.
+ *
+ * An ordered schedule instead runs in sweeps over the entries in id order, so that consecutive steps walk the
+ * population in memory order and all of an entry's steps in a sweep run back to back.  Each sweep gives every entry a
+ * Poisson number of steps with mean batch_size * priority / total; these counts are independent, which is what lets a
+ * priority change redraw just the changed entry.  An entry the sweep has not reached yet is redrawn at its new
+ * priority (so a newborn ahead of the sweep runs in it), while one the sweep has passed keeps the steps it already
+ * had.  Averaged over where the sweep is when an entry is born and when it dies, both cases give every entry the
+ * share of steps its priority earns while it is alive.
+ **/
+
+class cBatchProbSchedule : public Apto::PriorityScheduler
+{
+private:
+  Apto::SmartPtr<Apto::Random> m_rng;
+  int m_num_leaves;              // power of two >= entry count; leaf of entry i is node m_num_leaves + i
+  Apto::Array<double> m_tree;    // node n has children 2n and 2n + 1, root is node 1
+  
+  int m_batch_size;
+  bool m_ordered;
+  Apto::Array<int> m_batch;
+  Apto::Array<double> m_positions;
+  int m_batch_count;
+  int m_batch_pos;
+  
+  double m_sweep_rate;           // ordered: steps per unit of priority in the current sweep (0 before the first)
+  int m_last_entry;              // ordered: last entry the current sweep has reached
+  int m_run_left;                // ordered: steps left for the last entry reached
+  std::map<int, int> m_redrawn;  // ordered: steps of entries ahead of the sweep whose priority has changed
+  
+  int findEntry(double position) const;
+  bool startSweep();
+  int nextOrdered();
+  
+  
+  cBatchProbSchedule(); // @not_implemented
+  cBatchProbSchedule(const cBatchProbSchedule&); // @not_implemented
+  cBatchProbSchedule& operator=(const cBatchProbSchedule&); // @not_implemented
+  
+public:
+  cBatchProbSchedule(int entry_count, Apto::SmartPtr<Apto::Random> rng, int batch_size, bool ordered = false);
+  ~cBatchProbSchedule();
+  
+  void AdjustPriority(int entry_id, double priority);
+  int Next();
+  
+  // Draw count entries independently into entries, returning the number drawn (0 when every priority is zero)
+  int NextBatch(Apto::Array<int>& entries, int count);
+  
+  double GetTotalPriority() const { return m_tree[1]; }
+};
+
+#endif
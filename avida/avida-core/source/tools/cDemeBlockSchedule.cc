@@ -0,0 +1,74 @@
+/*
+ *  cDemeBlockSchedule.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cDemeBlockSchedule.h"
+
+#include "cBatchProbSchedule.h"
+
+#include <cassert>
+
+
+cDemeBlockSchedule::cDemeBlockSchedule(int entry_count, int num_demes, Apto::SmartPtr<Apto::Random> rng, int block_size)
+  : m_deme_size(entry_count / num_demes)
+  , m_block_size((block_size > 0) ? block_size : 1)
+  , m_cur_deme(-1)
+  , m_block_left(0)
+{
+  assert(num_demes > 0 && entry_count % num_demes == 0);
+  
+  // Demes draw from their own streams, seeded in deme order from the schedule's stream
+  m_demes.Resize(num_demes);
+  for (int i = 0; i < num_demes; i++) {
+    Apto::SmartPtr<Apto::Random> deme_rng(new Apto::RNG::AvidaRNG(rng->GetInt(0x7FFFFFFF)));
+    m_demes[i] = new cBatchProbSchedule(m_deme_size, deme_rng, m_block_size);
+  }
+  m_deme_schedule = new cBatchProbSchedule(num_demes, rng, 1);
+}
+
+cDemeBlockSchedule::~cDemeBlockSchedule()
+{
+  for (int i = 0; i < m_demes.GetSize(); i++) delete m_demes[i];
+  delete m_deme_schedule;
+}
+
+
+void cDemeBlockSchedule::AdjustPriority(int entry_id, double priority)
+{
+  const int deme_id = entry_id / m_deme_size;
+  assert(deme_id >= 0 && deme_id < m_demes.GetSize());
+  
+  m_demes[deme_id]->AdjustPriority(entry_id - deme_id * m_deme_size, priority);
+  m_deme_schedule->AdjustPriority(deme_id, m_demes[deme_id]->GetTotalPriority());
+}
+
+
+int cDemeBlockSchedule::Next()
+{
+  // Move on once the block is used up, or the current deme has nothing left to run
+  if (m_block_left == 0 || m_cur_deme < 0 || m_demes[m_cur_deme]->GetTotalPriority() <= 0.0) {
+    m_cur_deme = m_deme_schedule->Next();
+    if (m_cur_deme < 0) return -1;
+    m_block_left = m_block_size;
+  }
+  
+  m_block_left--;
+  return m_cur_deme * m_deme_size + m_demes[m_cur_deme]->Next();
+}
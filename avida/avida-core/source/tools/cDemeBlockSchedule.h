@@ -0,0 +1,67 @@
+/*
+ *  cDemeBlockSchedule.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cDemeBlockSchedule_h
+#define cDemeBlockSchedule_h
+
+#include "avida/core/Types.h"
+
+#include "apto/rng.h"
+#include "apto/scheduler.h"
+
+class cBatchProbSchedule;
+
+
+/**
+ * The DemeBlock Schedule gives every deme its own probabilistic schedule over its cells, each with its own random
+ * number stream, and hands out CPU cycles a deme at a time.  A deme is drawn with probability proportional to the
+ * total priority of its cells and then receives a block of consecutive cycles, each given to one of its cells with
+ * probability proportional to priority within the deme.  Every cycle therefore goes to a cell with the same
+ * probability as under Apto::Scheduler::Probabilistic, but a deme's organisms run together.
+ *
+ * Demes are the contiguous, equally sized cell ranges laid out by cPopulation.
+ **/
+
+class cDemeBlockSchedule : public Apto::PriorityScheduler
+{
+private:
+  int m_deme_size;
+  Apto::Array<cBatchProbSchedule*> m_demes;
+  cBatchProbSchedule* m_deme_schedule;    // priority of each deme is the total of its cells
+  
+  int m_block_size;
+  int m_cur_deme;
+  int m_block_left;
+  
+  
+  cDemeBlockSchedule(); // @not_implemented
+  cDemeBlockSchedule(const cDemeBlockSchedule&); // @not_implemented
+  cDemeBlockSchedule& operator=(const cDemeBlockSchedule&); // @not_implemented
+  
+public:
+  cDemeBlockSchedule(int entry_count, int num_demes, Apto::SmartPtr<Apto::Random> rng, int block_size);
+  ~cDemeBlockSchedule();
+  
+  void AdjustPriority(int entry_id, double priority);
+  int Next();
+};
+
+#endif
@@ -69,6 +69,14 @@ public:
     s1 -= w_val;
     s2 -= w_val * w_val;
   }
+  
+  void Merge(const cDoubleSum& other)
+  {
+    n += other.n;
+    s1 += other.s1;
+    s2 += other.s2;
+    if (other.max > max) max = other.max;
+  }
 };
 
 #endif
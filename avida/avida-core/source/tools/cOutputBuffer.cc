@@ -0,0 +1,141 @@
+/*
+ *  cOutputBuffer.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cOutputBuffer.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+
+cOutputBuffer::cOutputBuffer(std::ostream& out, int buf_size)
+  : m_out(out), m_buf(NULL), m_size(buf_size), m_pos(0)
+{
+  if (m_size < MAX_NUMBER_LENGTH) m_size = MAX_NUMBER_LENGTH;
+  m_buf = new char[m_size];
+}
+
+cOutputBuffer::~cOutputBuffer()
+{
+  Flush();
+  delete [] m_buf;
+}
+
+
+void cOutputBuffer::Flush()
+{
+  if (m_pos > 0) m_out.write(m_buf, m_pos);
+  m_pos = 0;
+}
+
+
+void cOutputBuffer::Append(const char* str, int len)
+{
+  if (len > m_size - m_pos) {
+    Flush();
+    // Oversized strings go straight through rather than being chunked
+    if (len > m_size) {
+      m_out.write(str, len);
+      return;
+    }
+  }
+  memcpy(m_buf + m_pos, str, len);
+  m_pos += len;
+}
+
+void cOutputBuffer::Append(const char* str)
+{
+  Append(str, strlen(str));
+}
+
+
+void cOutputBuffer::Append(int value)
+{
+  if (m_size - m_pos < MAX_NUMBER_LENGTH) Flush();
+  
+  // Work with the negated magnitude so that INT_MIN does not overflow
+  char digits[MAX_NUMBER_LENGTH];
+  int num_digits = 0;
+  const bool negative = (value < 0);
+  int rem = negative ? value : -value;
+  do {
+    digits[num_digits++] = '0' - (rem % 10);
+    rem /= 10;
+  } while (rem != 0);
+  
+  if (negative) m_buf[m_pos++] = '-';
+  while (num_digits > 0) m_buf[m_pos++] = digits[--num_digits];
+}
+
+
+void cOutputBuffer::Append(double value)
+{
+  // Integral values below 1e6 print under %g exactly as the integer would; that covers the bulk of genotype data
+  // (counts, lengths, ids, task totals).  Negative zero must keep its sign, so it takes the general path.
+  if (value > -1e6 && value < 1e6 && value == floor(value) && (value != 0.0 || 1.0 / value > 0.0)) {
+    Append(static_cast<int>(value));
+    return;
+  }
+  
+  if (m_size - m_pos < MAX_NUMBER_LENGTH) Flush();
+  m_pos += snprintf(m_buf + m_pos, MAX_NUMBER_LENGTH, "%g", value);
+}
+
+
+void cOutputBuffer::Append(const cFlexVar& value)
+{
+  switch (value.GetType()) {
+    case cFlexVar::TYPE_INT:    Append(value.AsInt()); break;
+    case cFlexVar::TYPE_BOOL:   Append(value.AsBool() ? '1' : '0'); break;
+    case cFlexVar::TYPE_CHAR:   Append(value.AsChar()); break;
+    case cFlexVar::TYPE_DOUBLE: Append(value.AsDouble()); break;
+    case cFlexVar::TYPE_STRING: Append(value.AsString()); break;
+    default: break;
+  }
+}
+
+
+void cOutputBuffer::AppendCSV(const cFlexVar& value)
+{
+  if (value.GetType() != cFlexVar::TYPE_STRING && value.GetType() != cFlexVar::TYPE_CHAR) {
+    Append(value);
+    return;
+  }
+  
+  // Quote any field that would otherwise break the record structure
+  const cString str = value.AsString();
+  bool needs_quotes = false;
+  for (int i = 0; i < str.GetSize() && !needs_quotes; i++) {
+    const char c = str[i];
+    needs_quotes = (c == ',' || c == '"' || c == '\n' || c == '\r');
+  }
+  if (!needs_quotes) {
+    Append(str);
+    return;
+  }
+  
+  Append('"');
+  for (int i = 0; i < str.GetSize(); i++) {
+    if (str[i] == '"') Append('"');
+    Append(str[i]);
+  }
+  Append('"');
+}
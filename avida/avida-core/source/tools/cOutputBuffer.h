@@ -0,0 +1,69 @@
+/*
+ *  cOutputBuffer.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cOutputBuffer_h
+#define cOutputBuffer_h
+
+#include "cFlexVar.h"
+#include "cString.h"
+
+#include <iostream>
+
+// Accumulates formatted output in a large in-memory block and hands it to the underlying stream in bulk, bypassing
+// the per-value locale and sentry overhead of ostream insertion.  Numbers are formatted to match the stream defaults
+// (precision 6, %g style), so files written through this buffer are byte-identical to the equivalent << output.
+
+class cOutputBuffer
+{
+private:
+  std::ostream& m_out;
+  char* m_buf;
+  int m_size;
+  int m_pos;
+  
+  
+  cOutputBuffer(); // @not_implemented
+  cOutputBuffer(const cOutputBuffer&); // @not_implemented
+  cOutputBuffer& operator=(const cOutputBuffer&); // @not_implemented
+  
+  // Worst case length of any single formatted number
+  static const int MAX_NUMBER_LENGTH = 32;
+  
+public:
+  cOutputBuffer(std::ostream& out, int buf_size = 1 << 20);
+  ~cOutputBuffer();
+  
+  void Flush();
+  
+  inline void Append(char c) { if (m_pos == m_size) Flush(); m_buf[m_pos++] = c; }
+  void Append(const char* str, int len);
+  void Append(const char* str);
+  void Append(const cString& str) { Append(str.GetData(), str.GetSize()); }
+  void Append(int value);
+  void Append(double value);
+  void Append(const cFlexVar& value);
+  
+  void AppendCSV(const cFlexVar& value);
+  
+  void EndLine() { Append('\n'); }
+};
+
+#endif
@@ -40,6 +40,7 @@ public:
   inline void Clear() { m_n = 0.0; m_m1 = 0.0; m_m2 = 0.0; m_m3 = 0.0; m_m4 = 0.0; }
   
   inline void Push(double x);
+  inline void Merge(const cRunningStats& other);
 
   inline double N() const { return m_n; }
   inline double Mean() const { return m_m1; }
@@ -64,4 +65,31 @@ inline void cRunningStats::Push(double x)
   m_m1 += d_n;
 }
 
+// Combine with the statistics of another sample, as if its values had been pushed here (up to rounding)
+inline void cRunningStats::Merge(const cRunningStats& other)
+{
+  if (other.m_n == 0.0) return;
+  if (m_n == 0.0) {
+    *this = other;
+    return;
+  }
+  
+  const double n_a = m_n;
+  const double n_b = other.m_n;
+  const double n = n_a + n_b;
+  const double d = other.m_m1 - m_m1;
+  const double d2 = d * d;
+  
+  const double m4 = m_m4 + other.m_m4 + d2 * d2 * n_a * n_b * (n_a * n_a - n_a * n_b + n_b * n_b) / (n * n * n)
+    + 6.0 * d2 * (n_a * n_a * other.m_m2 + n_b * n_b * m_m2) / (n * n) + 4.0 * d * (n_a * other.m_m3 - n_b * m_m3) / n;
+  const double m3 = m_m3 + other.m_m3 + d2 * d * n_a * n_b * (n_a - n_b) / (n * n) + 3.0 * d * (n_a * other.m_m2 - n_b * m_m2) / n;
+  const double m2 = m_m2 + other.m_m2 + d2 * n_a * n_b / n;
+  
+  m_n = n;
+  m_m1 += d * n_b / n;
+  m_m2 = m2;
+  m_m3 = m3;
+  m_m4 = m4;
+}
+
 #endif
@@ -0,0 +1,133 @@
+/*
+ *  logic_bench.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Microbenchmark for output logic identification (cTaskLib::SetupTests).  Times the original bit-at-a-time loop
+// against cLogicIdentifier, both with the inputs changing on every output and with several outputs per input set
+// (the common case for an organism between IO instructions).
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iomanip>
+
+#include "cLogicIdentifier.h"
+
+using namespace std;
+
+
+static int ReferenceLogicId(const int* inputs, int num_inputs, int test_output)
+{
+  int test_inputs[3];
+  for (int i = 0; i < 3; i++) test_inputs[i] = (num_inputs > i) ? inputs[i] : 0;
+  
+  int logic_out[8];
+  for (int i = 0; i < 8; i++) logic_out[i] = -1;
+  for (int test_pos = 0; test_pos < 32; test_pos++) {
+    int logic_pos = 0;
+    for (int i = 0; i < 3; i++) logic_pos += (test_inputs[i] & 1) << i;
+    if (logic_out[logic_pos] != -1 && logic_out[logic_pos] != (test_output & 1)) return -1;
+    logic_out[logic_pos] = test_output & 1;
+    test_output >>= 1;
+    for (int i = 0; i < 3; i++) test_inputs[i] >>= 1;
+  }
+  
+  if (num_inputs < 1) logic_out[1] = logic_out[0];
+  if (num_inputs < 2) { logic_out[2] = logic_out[0]; logic_out[3] = logic_out[1]; }
+  if (num_inputs < 3) for (int i = 0; i < 4; i++) logic_out[i + 4] = logic_out[i];
+  
+  int logic_id = 0;
+  for (int i = 0; i < 8; i++) logic_id += logic_out[i] * (1 << i);
+  return logic_id;
+}
+
+
+int main(int argc, char* argv[])
+{
+  const int num_sets = 4096;
+  const int outputs_per_set = 4;
+  const int reps = (argc > 1) ? atoi(argv[1]) : 500;
+  
+  // Environment-style inputs with every logic function of them as an output
+  int* inputs = new int[num_sets * 3];
+  int* outputs = new int[num_sets * outputs_per_set];
+  srand(1);
+  for (int set = 0; set < num_sets; set++) {
+    for (int i = 0; i < 3; i++) inputs[set * 3 + i] = (rand() << 16) ^ rand();
+    const unsigned int a = inputs[set * 3], b = inputs[set * 3 + 1], c = inputs[set * 3 + 2];
+    for (int o = 0; o < outputs_per_set; o++) {
+      const int function = rand() & 0xff;
+      unsigned int output = 0;
+      for (int combo = 0; combo < 8; combo++) {
+        if ((function >> combo) & 1) output |= ((combo & 1) ? a : ~a) & ((combo & 2) ? b : ~b) & ((combo & 4) ? c : ~c);
+      }
+      outputs[set * outputs_per_set + o] = static_cast<int>(output);
+    }
+  }
+  
+  const double num_calls = static_cast<double>(reps) * num_sets * outputs_per_set;
+  long long checksum[3] = { 0, 0, 0 };
+  double seconds[3];
+  
+  clock_t start = clock();
+  for (int rep = 0; rep < reps; rep++) {
+    for (int set = 0; set < num_sets; set++) {
+      for (int o = 0; o < outputs_per_set; o++) {
+        checksum[0] += ReferenceLogicId(inputs + set * 3, 3, outputs[set * outputs_per_set + o]);
+      }
+    }
+  }
+  seconds[0] = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+  
+  start = clock();
+  for (int rep = 0; rep < reps; rep++) {
+    for (int set = 0; set < num_sets; set++) {
+      for (int o = 0; o < outputs_per_set; o++) {
+        checksum[1] += cLogicIdentifier::ComputeLogicId(inputs + set * 3, 3, outputs[set * outputs_per_set + o]);
+      }
+    }
+  }
+  seconds[1] = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+  
+  start = clock();
+  cLogicIdentifier ident;
+  for (int rep = 0; rep < reps; rep++) {
+    for (int set = 0; set < num_sets; set++) {
+      ident.SetInputs(inputs + set * 3, 3);
+      for (int o = 0; o < outputs_per_set; o++) checksum[2] += ident.GetLogicId(outputs[set * outputs_per_set + o]);
+    }
+  }
+  seconds[2] = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+  
+  const char* names[3] = { "bitwise reference", "identifier (new inputs)", "identifier (cached inputs)" };
+  for (int i = 0; i < 3; i++) {
+    cout << setw(28) << left << names[i] << setw(10) << right << fixed << setprecision(2)
+         << (seconds[i] * 1.0e9 / num_calls) << " ns/output" << endl;
+  }
+  
+  delete [] inputs;
+  delete [] outputs;
+  
+  if (checksum[1] != checksum[0] || checksum[2] != checksum[0]) {
+    cerr << "error: results differ from the reference" << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -103,6 +103,7 @@ void Avida::CoreView::Driver::Run()
 {
   cPopulation& population = m_world->GetPopulation();
   cStats& stats = m_world->GetStats();
+  stats.RequireOrgStats();
   
   Data::Manager& dm = m_world->GetDataManager();
   
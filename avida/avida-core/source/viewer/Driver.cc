@@ -56,6 +56,9 @@ Avida::Viewer::Driver::Driver(cWorld* world, World* new_world)
 , m_paused(false), m_pause_at(-2), m_map(NULL)
 {
   GlobalObjectManager::Register(this);
+  
+  // The viewer may change reaction values at any time through SetReactionValue
+  m_world->GetEnvironment().DeclareReactionValueWriter();
 }
 
 Avida::Viewer::Driver::~Driver()